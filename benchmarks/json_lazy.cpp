@@ -0,0 +1,78 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& read)
+{
+    double sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) sum += read();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << elapsed / iterations * 1e3 << " ms, " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << sum / iterations << ")\n";
+}
+
+int main(int argc, char** argv)
+{
+    using namespace softloq::whatwg;
+
+    // one large list of API-response-like records, 100 MB unless another size in MB is given
+    const std::size_t target = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100) << 20;
+    std::string document = "[";
+    for (std::size_t i = 0; document.size() < target; ++i)
+    {
+        const std::string id = std::to_string(i);
+        (document += i ? ",\n  " : "\n  ") += "{\"id\": " + id + ", \"name\": \"user " + id + "\", \"score\": " + std::to_string(i * 0.37) +
+            ", \"active\": " + (i % 3 ? "true" : "false") + ", \"note\": \"caf\xC3\xA9 line\\nnext \\\"quoted\\\" \\u00e9\", \"parent\": null," +
+            " \"tags\": [\"alpha\", \"beta\", \"gamma\"], \"location\": {\"lat\": -33.8688" + id + ", \"lng\": 151.2093, \"zoom\": 12}," +
+            " \"history\": [1, 2, 3, 5, 8, 13, 21, 34]}";
+    }
+    document += "\n]";
+    const infra_string id{"id"}, score{"score"}, location{"location"}, lat{"lat"};
+    constexpr std::size_t iterations = 3;
+    std::cout << document.size() / 1e6 << " MB\n";
+
+    // a few fields: the id of the middle record and the latitude of the last one
+    infra_json_document full;
+    run("full, a few fields", document.size(), iterations, [&]
+    {
+        full.parse(document);
+        const auto& records = full.root().as_list();
+        return records[records.size() / 2].find(id)->as_number() + records.back().find(location)->find(lat)->as_number();
+    });
+    infra_json_lazy_document lazy;
+    run("lazy, a few fields", document.size(), iterations, [&]
+    {
+        lazy.parse(document);
+        const infra_json_lazy_value records = lazy.root();
+        const std::size_t size = records.size();
+        return *records.at(size / 2)->find(id)->as_number() + *records.at(size - 1)->find(location)->find(lat)->as_number();
+    });
+
+    // one field of every record
+    run("full, one field of each record", document.size(), iterations, [&]
+    {
+        full.parse(document);
+        double sum = 0;
+        for (const auto& record: full.root().as_list()) sum += record.find(score)->as_number();
+        return sum;
+    });
+    run("lazy, one field of each record", document.size(), iterations, [&]
+    {
+        lazy.parse(document);
+        double sum = 0;
+        for (const infra_json_lazy_value record: lazy.root()) sum += *record.find(score)->as_number();
+        return sum;
+    });
+
+    // everything, for the cost of going through the lazy document first
+    run("lazy, materialized", document.size(), iterations, [&]
+    {
+        lazy.parse(document);
+        return static_cast<double>(lazy.root().materialize()->as_list().size());
+    });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& parse)
+{
+    std::size_t values = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) values += parse();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << values / iterations << " values out)\n";
+}
+
+// reads one character at a time with recursive descent, appending each string one code point at a time
+struct per_character_parser
+{
+    const std::string& text;
+    std::size_t i = 0;
+
+    void skip()
+    {
+        while (i < text.size() && (text[i] == ' ' || text[i] == '\t' || text[i] == '\n' || text[i] == '\r')) ++i;
+    }
+    softloq::whatwg::infra_string string()
+    {
+        using namespace softloq::whatwg;
+        infra_string string;
+        for (++i; text[i] != '"';)
+        {
+            if (text[i] == '\\')
+            {
+                const char c = text[i + 1];
+                if (c == 'u') string += infra_code_unit{static_cast<std::uint16_t>(std::strtoul(text.substr(i + 2, 4).c_str(), nullptr, 16))}, i += 6;
+                else string += infra_code_point{static_cast<std::uint32_t>(c == 'n' ? '\n' : c == 't' ? '\t' : c == 'r' ? '\r' : c == 'b' ? '\b' : c == 'f' ? '\f' : c)}, i += 2;
+                continue;
+            }
+            const unsigned char lead = text[i];
+            const std::size_t size = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+            std::uint32_t point = size == 1 ? lead : lead & (0x7F >> size);
+            for (std::size_t j = 1; j < size; ++j) point = (point << 6) | (text[i + j] & 0x3F);
+            string += infra_code_point{point};
+            i += size;
+        }
+        ++i;
+        return string;
+    }
+    softloq::whatwg::infra_json_value value(std::size_t& count)
+    {
+        using namespace softloq::whatwg;
+        ++count;
+        skip();
+        if (text[i] == '"') return infra_json_value{string()};
+        if (text[i] == '[')
+        {
+            infra_json_value::list_type list;
+            for (++i, skip(); text[i] != ']'; skip()) { list.push_back(value(count)); skip(); if (text[i] == ',') ++i; }
+            ++i;
+            return infra_json_value{std::move(list)};
+        }
+        if (text[i] == '{')
+        {
+            infra_json_value::map_type map;
+            for (++i, skip(); text[i] != '}'; skip())
+            {
+                infra_string key = string();
+                skip();
+                ++i;
+                map.emplace_back(std::move(key), value(count));
+                skip();
+                if (text[i] == ',') ++i;
+            }
+            ++i;
+            return infra_json_value{std::move(map)};
+        }
+        if (text[i] == 't') return i += 4, infra_json_value{true};
+        if (text[i] == 'f') return i += 5, infra_json_value{false};
+        if (text[i] == 'n') return i += 4, infra_json_value{};
+        char* end;
+        const double number = std::strtod(text.c_str() + i, &end);
+        i = end - text.c_str();
+        return infra_json_value{number};
+    }
+};
+
+static std::size_t count_values(const softloq::whatwg::infra_json_value& value)
+{
+    std::size_t count = 1;
+    if (value.is_list()) for (const auto& item: value.as_list()) count += count_values(item);
+    else if (value.is_map()) for (const auto& entry: value.as_map()) count += count_values(entry.second);
+    return count;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // API-response-like records: short keys, integers, decimals, plain and escaped strings, some UTF-8, and nesting
+    std::vector<std::string> records;
+    for (std::size_t i = 0; i < 8192; ++i)
+    {
+        const std::string id = std::to_string(i);
+        records.push_back("{\"id\": " + id + ", \"name\": \"user " + id + "\", \"score\": " + std::to_string(i * 0.37) +
+            ", \"active\": " + (i % 3 ? "true" : "false") + ", \"note\": \"caf\xC3\xA9 line\\nnext \\\"quoted\\\" \\u00e9\", \"parent\": null," +
+            " \"tags\": [\"alpha\", \"beta\", \"gamma\"], \"location\": {\"lat\": -33.8688" + id + ", \"lng\": 151.2093, \"zoom\": 12}," +
+            " \"history\": [1, 2, 3, 5, 8, 13, 21, 34]}");
+    }
+    std::string document = "[";
+    for (std::size_t i = 0; i < records.size(); ++i) (document += i ? ",\n  " : "\n  ") += records[i];
+    document += "\n]";
+    std::size_t record_bytes = 0;
+    for (const auto& record: records) record_bytes += record.size();
+    constexpr std::size_t iterations = 20;
+
+    run("infra_json_value::parse", document.size(), iterations, [&] { return count_values(*infra_json_value::parse(document)); });
+    infra_json_document parsed;
+    run("infra_json_document::parse", document.size(), iterations, [&] { parsed.parse(document); return count_values(parsed.root()); });
+    run("per character recursive descent", document.size(), iterations / 4, [&]
+    {
+        std::size_t count = 0;
+        per_character_parser{document}.value(count);
+        return count;
+    });
+
+    // many small texts, where allocating and freeing the values dominates
+    run("infra_json_value::parse records", record_bytes, iterations, [&]
+    {
+        std::size_t count = 0;
+        for (const auto& record: records) count += count_values(*infra_json_value::parse(record));
+        return count;
+    });
+    run("infra_json_document::parse records", record_bytes, iterations, [&]
+    {
+        std::size_t count = 0;
+        for (const auto& record: records) parsed.parse(record), count += count_values(parsed.root());
+        return count;
+    });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t iterations, Fn&& serialize)
+{
+    std::size_t bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) bytes += serialize();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) / elapsed / 1e9 << " GB/s (" << bytes / iterations << " bytes out)\n";
+}
+
+// writes through std::ostream one code point at a time, the way print() output had to be turned into JSON before
+static void write_per_code_point(std::ostream& out, const softloq::whatwg::infra_json_value& value)
+{
+    using namespace softloq::whatwg;
+    switch (value.type())
+    {
+    case infra_json_type::infra_null: out << "null"; break;
+    case infra_json_type::infra_bool: out << (value.as_bool() ? "true" : "false"); break;
+    case infra_json_type::infra_number: out << value.as_number(); break;
+    case infra_json_type::infra_string:
+        out << '"';
+        for (const auto point: value.as_string().code_points())
+        {
+            const std::uint32_t c = point;
+            if (c == '"' || c == '\\') out << '\\' << static_cast<char>(c);
+            else if (c < 0x20) out << "\\u00" << "0123456789abcdef"[c >> 4] << "0123456789abcdef"[c & 0xF];
+            else if (c < 0x80) out << static_cast<char>(c);
+            else if (c < 0x800) out << static_cast<char>(0xC0 | c >> 6) << static_cast<char>(0x80 | (c & 0x3F));
+            else if (c < 0x10000) out << static_cast<char>(0xE0 | c >> 12) << static_cast<char>(0x80 | (c >> 6 & 0x3F)) << static_cast<char>(0x80 | (c & 0x3F));
+            else out << static_cast<char>(0xF0 | c >> 18) << static_cast<char>(0x80 | (c >> 12 & 0x3F)) << static_cast<char>(0x80 | (c >> 6 & 0x3F)) << static_cast<char>(0x80 | (c & 0x3F));
+        }
+        out << '"';
+        break;
+    case infra_json_type::infra_list:
+    {
+        out << '[';
+        bool first = true;
+        for (const auto& item: value.as_list()) (first ? out : out << ','), write_per_code_point(out, item), first = false;
+        out << ']';
+        break;
+    }
+    case infra_json_type::infra_map:
+    {
+        out << '{';
+        bool first = true;
+        for (const auto& entry: value.as_map())
+        {
+            if (!first) out << ',';
+            write_per_code_point(out, infra_json_value{entry.first});
+            out << ':';
+            write_per_code_point(out, entry.second);
+            first = false;
+        }
+        out << '}';
+        break;
+    }
+    }
+}
+
+// counts the bytes without keeping them, as a socket or file writer would
+struct counting_sink final: softloq::whatwg::infra_json_sink
+{
+    std::size_t bytes = 0;
+    void write(const std::uint8_t*, const std::size_t count) noexcept override { bytes += count; }
+};
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // API-response-like records, once with mostly numbers and short keys and once with long text fields
+    std::string records = "[", text = "[";
+    for (std::size_t i = 0; i < 8192; ++i)
+    {
+        const std::string id = std::to_string(i);
+        (records += i ? "," : "") += "{\"id\": " + id + ", \"name\": \"user " + id + "\", \"score\": " + std::to_string(i * 0.37) + ", \"active\": true, \"tags\": [\"alpha\", \"beta\"], \"location\": {\"lat\": -33.8688, \"lng\": 151.2093}}";
+        (text += i ? "," : "") += "\"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\\n"
+            "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. caf\xC3\xA9 \\\"" + id + "\\\"\"";
+    }
+    records += "]";
+    text += "]";
+    const infra_json_value record_value = *infra_json_value::parse(records);
+    const infra_json_value text_value = *infra_json_value::parse(text);
+    constexpr std::size_t iterations = 20;
+
+    run("serialize records", iterations, [&] { return record_value.serialize().size(); });
+    run("serialize text", iterations, [&] { return text_value.serialize().size(); });
+    run("serialize records to a sink", iterations, [&] { counting_sink sink; record_value.serialize(sink); return sink.bytes; });
+    run("serialize text to a sink", iterations, [&] { counting_sink sink; text_value.serialize(sink); return sink.bytes; });
+    run("per code point std::ostream text", iterations / 4, [&] { std::ostringstream out; write_per_code_point(out, text_value); return out.str().size(); });
+    run("per code point std::ostream records", iterations / 4, [&] { std::ostringstream out; write_per_code_point(out, record_value); return out.str().size(); });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t items, const std::size_t iterations, Fn&& work)
+{
+    std::uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) sum += work();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << elapsed / (items * iterations) * 1e9 << " ns per item (" << sum / iterations << ")\n";
+}
+
+template <class List>
+static void compare(const char* backing)
+{
+    constexpr std::size_t items = 1 << 20;
+    constexpr std::size_t inserts = 1 << 8;
+    std::cout << backing << "\n";
+
+    run("  append", items, 8, [&]
+    {
+        List list;
+        for (std::uint32_t i = 0; i < items; ++i) list.append(i);
+        return static_cast<std::uint64_t>(list.size());
+    });
+
+    List list;
+    for (std::uint32_t i = 0; i < items; ++i) list.append(i * 2654435761u);
+    run("  iterate", items, 32, [&]
+    {
+        std::uint64_t sum = 0;
+        for (const std::uint32_t item: list) sum += item;
+        return sum;
+    });
+    run("  contains (missing item)", items, 8, [&] { return static_cast<std::uint64_t>(list.contains(1)); });
+    run("  sort_ascending", items, 1, [&]
+    {
+        List copy = list;
+        copy.sort_ascending();
+        return static_cast<std::uint64_t>(copy.front());
+    });
+    run("  insert at random index", inserts, 1, [&]
+    {
+        List copy = list;
+        std::uint32_t seed = 1;
+        for (std::size_t i = 0; i < inserts; ++i) copy.insert((seed = seed * 1664525u + 1013904223u) % copy.size(), i);
+        return static_cast<std::uint64_t>(copy.size());
+    });
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    compare<infra_list<std::uint32_t>>("infra_list (std::deque blocks)");
+    compare<infra_list<std::uint32_t, std::vector<std::uint32_t>>>("infra_list (std::vector)");
+    compare<infra_node_list<std::uint32_t>>("infra_node_list (std::list nodes)");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// each reader thread runs the same mix of const calls on one shared list; a writer changes it now and then
+template <class List>
+static void scale(const char* policy)
+{
+    constexpr std::size_t items = 256;
+    constexpr std::size_t reads = 1 << 16;
+    std::cout << policy << std::endl;
+
+    List list;
+    for (std::uint32_t i = 0; i < items; ++i) list.append(i * 2654435761u);
+    const std::size_t most = std::max<std::size_t>(8, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= most; threads *= 2)
+    {
+        std::uint64_t sum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        {
+            std::vector<std::jthread> readers;
+            for (std::size_t t = 0; t < threads; ++t) readers.emplace_back([&]
+            {
+                std::uint64_t local = 0;
+                for (std::size_t i = 0; i < reads; ++i)
+                {
+                    local += list.contains(static_cast<std::uint32_t>(i)) + list.size() + list.front();
+                    if (i % 64 == 0) list.for_each([&](const std::uint32_t& item) { local += item; });
+                }
+                std::atomic_ref<std::uint64_t>(sum).fetch_add(local);
+            });
+            std::jthread writer([&]
+            {
+                for (std::size_t i = 0; i < 16; ++i)
+                {
+                    list.append(static_cast<std::uint32_t>(i));
+                    list.pop_back();
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            });
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << threads << " readers: " << threads * reads / elapsed / 1e6 << " M reads/s (" << sum % 1000 << ")" << std::endl;
+    }
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    scale<infra_list<std::uint32_t>>("infra_list (std::mutex)");
+    scale<infra_shared_list<std::uint32_t>>("infra_shared_list (std::shared_mutex)");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// a producer enqueues items with a pause between them, as a slow pipeline stage does; reports the process CPU time the consumer burns waiting
+template <class Consume>
+static void idle(const char* name, softloq::whatwg::infra_queue<std::uint64_t>& queue, Consume&& consume)
+{
+    constexpr std::uint64_t items = 2000;
+    const std::clock_t cpu_start = std::clock();
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::jthread producer([&]
+        {
+            for (std::uint64_t i = 1; i <= items; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds{100});
+                queue.enqueue(i);
+            }
+        });
+        std::uint64_t sum = 0;
+        while (sum != items * (items + 1) / 2) sum += consume();
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double cpu = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    std::cout << "  " << name << ": " << elapsed * 1e3 << " ms wall, " << cpu * 1e3 << " ms cpu" << std::endl;
+}
+
+// a producer enqueues as fast as it can while one consumer drains the queue
+template <class Consume>
+static void drain(const char* name, Consume&& consume)
+{
+    constexpr std::uint64_t items = 1 << 21;
+    softloq::whatwg::infra_queue<std::uint64_t> queue;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::jthread producer([&] { for (std::uint64_t i = 0; i < items; ++i) queue.enqueue(i); });
+        for (std::uint64_t taken = 0; taken < items;) taken += consume(queue);
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << name << ": " << items / elapsed / 1e6 << " M items/s" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    std::cout << "idle consumer, 2000 items 100 us apart" << std::endl;
+    {
+        infra_queue<std::uint64_t> queue;
+        idle("dequeue + yield", queue, [&]
+        {
+            if (const auto item = queue.dequeue()) return *item;
+            std::this_thread::yield();
+            return std::uint64_t{0};
+        });
+    }
+    {
+        infra_queue<std::uint64_t> queue;
+        idle("wait_dequeue", queue, [&] { return queue.wait_dequeue(); });
+    }
+
+    std::cout << "busy consumer" << std::endl;
+    drain("dequeue + yield", [](infra_queue<std::uint64_t>& queue)
+    {
+        if (queue.dequeue()) return std::uint64_t{1};
+        std::this_thread::yield();
+        return std::uint64_t{0};
+    });
+    drain("wait_dequeue", [](infra_queue<std::uint64_t>& queue)
+    {
+        queue.wait_dequeue();
+        return std::uint64_t{1};
+    });
+    drain("wait_dequeue + dequeue_bulk of 256", [](infra_queue<std::uint64_t>& queue)
+    {
+        static std::vector<std::uint64_t> batch(256);
+        queue.wait_dequeue();
+        return 1 + queue.dequeue_bulk(batch.begin(), batch.size());
+    });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// fills a queue of strings, then times taking every item out with one of the dequeue calls
+template <class Drain>
+static void run(const char* name, Drain&& drain)
+{
+    constexpr std::size_t items = 1 << 18;
+    softloq::whatwg::infra_queue<softloq::whatwg::infra_string> queue;
+    for (std::size_t i = 0; i < items; ++i) queue.enqueue(softloq::whatwg::infra_string{std::string(48, static_cast<char>('a' + i % 26))});
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t checksum = drain(queue);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << name << ": " << items / elapsed / 1e6 << " M items/s (" << checksum << ")" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    using queue_type = infra_queue<infra_string>;
+
+    std::cout << "48 code unit infra_string items" << std::endl;
+    run("peek copy + dequeue", [](queue_type& queue)
+    {
+        std::uint64_t sum = 0;
+        while (const auto item = queue.peek()) sum += item->size(), queue.dequeue();
+        return sum;
+    });
+    run("peek callback + dequeue", [](queue_type& queue)
+    {
+        std::uint64_t sum = 0;
+        while (queue.peek([&](const infra_string& item) { sum += item.size(); })) queue.dequeue();
+        return sum;
+    });
+    run("dequeue", [](queue_type& queue)
+    {
+        std::uint64_t sum = 0;
+        while (const auto item = queue.dequeue()) sum += item->size();
+        return sum;
+    });
+    run("try_dequeue", [](queue_type& queue)
+    {
+        std::uint64_t sum = 0;
+        infra_string item;
+        while (queue.try_dequeue(item)) sum += item.size();
+        return sum;
+    });
+    run("dequeue_into, batches of 64", [](queue_type& queue)
+    {
+        std::uint64_t sum = 0;
+        std::vector<infra_string> batch(64);
+        while (const auto count = queue.dequeue_into(batch))
+        {
+            for (std::size_t i = 0; i < count; ++i) sum += batch[i].size();
+        }
+        return sum;
+    });
+    return 0;
+}
\ No newline at end of file
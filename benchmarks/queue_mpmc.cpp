@@ -0,0 +1,59 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// producers and consumers in equal numbers pass a fixed number of items through one queue; a thread that finds the queue full or empty yields
+template <class Enqueue, class Dequeue>
+static void run(const std::size_t pairs, const std::size_t items, Enqueue&& enqueue, Dequeue&& dequeue)
+{
+    std::atomic<std::uint64_t> sum = 0;
+    std::atomic<std::size_t> taken = 0;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t p = 0; p < pairs; ++p) threads.emplace_back([&]
+        {
+            for (std::uint64_t i = 0; i < items / pairs; ++i) while (!enqueue(i)) std::this_thread::yield();
+        });
+        for (std::size_t c = 0; c < pairs; ++c) threads.emplace_back([&]
+        {
+            std::uint64_t local = 0;
+            while (taken.load(std::memory_order_relaxed) < items / pairs * pairs)
+            {
+                if (const auto item = dequeue()) local += *item, taken.fetch_add(1, std::memory_order_relaxed);
+                else std::this_thread::yield();
+            }
+            sum += local;
+        });
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << pairs << " producers, " << pairs << " consumers: " << items / elapsed / 1e6 << " M items/s (" << sum % 1000 << ")" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    constexpr std::size_t items = 1 << 21;
+    const std::size_t most = std::max<std::size_t>(4, std::thread::hardware_concurrency() / 2);
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << "infra_queue (std::mutex, std::deque)" << std::endl;
+    for (std::size_t pairs = 1; pairs <= most; pairs *= 2)
+    {
+        infra_queue<std::uint64_t> queue;
+        run(pairs, items, [&](const std::uint64_t item) { queue.enqueue(item); return true; }, [&] { return queue.dequeue(); });
+    }
+    std::cout << "infra_mpmc_queue (1024 slots)" << std::endl;
+    for (std::size_t pairs = 1; pairs <= most; pairs *= 2)
+    {
+        infra_mpmc_queue<std::uint64_t> queue{1024};
+        run(pairs, items, [&](const std::uint64_t item) { return queue.enqueue(item); }, [&] { return queue.dequeue(); });
+    }
+    return 0;
+}
\ No newline at end of file
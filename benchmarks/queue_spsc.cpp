@@ -0,0 +1,76 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+// one producer thread passes a fixed number of items to one consumer thread; a thread that finds the queue full or empty yields
+template <class Produce, class Consume>
+static void run(const char* name, const std::uint64_t items, Produce&& produce, Consume&& consume)
+{
+    std::uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::jthread producer([&]
+        {
+            for (std::uint64_t i = 0; i < items;)
+            {
+                const std::uint64_t added = produce(i, items - i);
+                if (added == 0) std::this_thread::yield();
+                i += added;
+            }
+        });
+        for (std::uint64_t taken = 0; taken < items;)
+        {
+            const std::uint64_t removed = consume(sum);
+            if (removed == 0) std::this_thread::yield();
+            taken += removed;
+        }
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << name << ": " << items / elapsed / 1e6 << " M items/s (" << sum % 1000 << ")" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    constexpr std::uint64_t items = 1 << 22;
+    constexpr std::uint64_t batch = 64;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    {
+        infra_queue<std::uint64_t> queue;
+        run("infra_queue", items, [&](const std::uint64_t i, const std::uint64_t) { queue.enqueue(i); return std::uint64_t{1}; },
+            [&](std::uint64_t& sum) { const auto item = queue.dequeue(); if (item) sum += *item; return std::uint64_t{item ? 1u : 0u}; });
+    }
+    {
+        infra_mpmc_queue<std::uint64_t> queue{1024};
+        run("infra_mpmc_queue", items, [&](const std::uint64_t i, const std::uint64_t) { return std::uint64_t{queue.enqueue(i)}; },
+            [&](std::uint64_t& sum) { const auto item = queue.dequeue(); if (item) sum += *item; return std::uint64_t{item ? 1u : 0u}; });
+    }
+    {
+        infra_spsc_queue<std::uint64_t> queue{1024};
+        run("infra_spsc_queue", items, [&](const std::uint64_t i, const std::uint64_t) { return std::uint64_t{queue.enqueue(i)}; },
+            [&](std::uint64_t& sum) { const auto item = queue.dequeue(); if (item) sum += *item; return std::uint64_t{item ? 1u : 0u}; });
+    }
+    {
+        infra_spsc_queue<std::uint64_t> queue{1024};
+        run("infra_spsc_queue, batches of 64", items, [&](const std::uint64_t i, const std::uint64_t left)
+        {
+            std::array<std::uint64_t, batch> values;
+            for (std::uint64_t k = 0; k < batch; ++k) values[k] = i + k;
+            return std::uint64_t{queue.enqueue_n(values.data(), std::min(batch, left))};
+        },
+        [&](std::uint64_t& sum)
+        {
+            std::array<std::uint64_t, batch> values;
+            const std::uint64_t removed = queue.dequeue_n(values.data(), batch);
+            for (std::uint64_t k = 0; k < removed; ++k) sum += values[k];
+            return removed;
+        });
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// deduplicates tokens as a class list or rel attribute does: each token is added unless it is already there
+template <class Dedup>
+static void run(const char* name, const std::vector<softloq::whatwg::infra_string>& tokens, Dedup&& dedup)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t kept = dedup(tokens);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "    " << name << ": " << elapsed * 1e3 << " ms (" << kept << " kept)" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    for (const std::size_t unique: {16, 256, 4096})
+    {
+        // every distinct token appears four times
+        std::vector<infra_string> tokens;
+        for (std::size_t round = 0; round < 4; ++round)
+        {
+            for (std::size_t i = 0; i < unique; ++i) tokens.emplace_back("token-" + std::to_string(i * 7919 % unique));
+        }
+        const std::size_t repeat = 65536 / tokens.size();
+        std::cout << tokens.size() << " tokens, " << unique << " distinct, " << repeat << " times" << std::endl;
+        run("infra_list contains + append", tokens, [repeat](const std::vector<infra_string>& tokens)
+        {
+            std::size_t kept = 0;
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                infra_list<infra_string> list;
+                for (const infra_string& token: tokens) if (!list.contains(token)) list.append(token);
+                kept = list.size();
+            }
+            return kept;
+        });
+        run("infra_ordered_set append", tokens, [repeat](const std::vector<infra_string>& tokens)
+        {
+            std::size_t kept = 0;
+            for (std::size_t r = 0; r < repeat; ++r)
+            {
+                infra_ordered_set<infra_string> set;
+                for (const infra_string& token: tokens) set.append(token);
+                kept = set.size();
+            }
+            return kept;
+        });
+    }
+    return 0;
+}
\ No newline at end of file
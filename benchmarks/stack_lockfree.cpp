@@ -0,0 +1,45 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// threads share a free-list of reusable contexts: each round pops a context, uses it and pushes it back
+template <class Stack>
+static void run(const std::size_t threads, const std::size_t rounds)
+{
+    Stack stack;
+    for (std::uint64_t context = 0; context < 64; ++context) stack.push(context);
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t t = 0; t < threads; ++t) workers.emplace_back([&]
+        {
+            for (std::size_t round = 0; round < rounds / threads; ++round)
+            {
+                if (const auto context = stack.pop()) stack.push(*context + 1);
+            }
+        });
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::uint64_t sum = 0;
+    while (const auto context = stack.pop()) sum += *context;
+    std::cout << "  " << threads << " threads: " << rounds / elapsed / 1e6 << " M pop+push/s (" << sum % 1000 << ")" << std::endl;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+    constexpr std::size_t rounds = 1 << 21;
+    const std::size_t most = std::max<std::size_t>(8, std::thread::hardware_concurrency());
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << "infra_stack (std::mutex, std::deque)" << std::endl;
+    for (std::size_t threads = 1; threads <= most; threads *= 2) run<infra_stack<std::uint64_t>>(threads, rounds);
+    std::cout << "infra_lockfree_stack" << std::endl;
+    for (std::size_t threads = 1; threads <= most; threads *= 2) run<infra_lockfree_stack<std::uint64_t>>(threads, rounds);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& convert)
+{
+    std::size_t units = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) units += convert();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << units / iterations << " units out)\n";
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // 4 MiB of binary data, encoded once as is and once wrapped at 76 characters the way MIME does
+    constexpr std::size_t size = 4 << 20;
+    constexpr std::size_t iterations = 50;
+    std::string text(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) text[i] = static_cast<char>(i * 31 + (i >> 7));
+    const infra_byte_sequence bytes{text};
+    const infra_string encoded = infra_string::forgiving_base64_encode(bytes);
+    infra_string wrapped;
+    for (std::size_t i = 0; i < encoded.size(); i += 76) (wrapped += infra_string_view{encoded}.code_unit_substr(i, 76)) += "\r\n";
+
+    run("forgiving_base64_encode", size, iterations, [&] { return infra_string::forgiving_base64_encode(bytes).size(); });
+    run("forgiving_base64_decode", encoded.size(), iterations, [&] { return encoded.forgiving_base64_decode()->size(); });
+    run("forgiving_base64_decode wrapped", wrapped.size(), iterations, [&] { return wrapped.forgiving_base64_decode()->size(); });
+    // the streaming decoder appends to a sequence that is reused, the way a reader filling one buffer would
+    infra_byte_sequence decoded;
+    run("infra_base64_decoder 64 KiB chunks", wrapped.size(), iterations, [&]
+    {
+        infra_base64_decoder decoder;
+        decoded.clear();
+        const infra_string_view view{wrapped};
+        for (std::size_t i = 0; i < view.size(); i += 64 << 10) decoder.decode(view.code_unit_substr(i, 64 << 10), decoded);
+        decoder.finish(decoded);
+        return decoded.size();
+    });
+
+    // the same decoding one character at a time, for comparison
+    run("per character forgiving_base64_decode wrapped", wrapped.size(), iterations / 10, [&]
+    {
+        infra_byte_sequence decoded;
+        std::uint32_t bits = 0, sextets = 0;
+        for (const auto unit: wrapped.code_units())
+        {
+            const std::uint16_t c = unit;
+            std::uint32_t value;
+            if (c >= 'A' && c <= 'Z') value = c - 'A';
+            else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+            else if (c >= '0' && c <= '9') value = c - '0' + 52;
+            else if (c == '+') value = 62;
+            else if (c == '/') value = 63;
+            else continue;
+            bits = bits << 6 | value;
+            if (++sextets % 4 == 0)
+            {
+                decoded.push_back(infra_byte{static_cast<std::uint8_t>(bits >> 16)});
+                decoded.push_back(infra_byte{static_cast<std::uint8_t>(bits >> 8)});
+                decoded.push_back(infra_byte{static_cast<std::uint8_t>(bits)});
+            }
+        }
+        return decoded.size();
+    });
+    return 0;
+}
\ No newline at end of file
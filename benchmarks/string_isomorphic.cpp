@@ -0,0 +1,47 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& convert)
+{
+    std::size_t units = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) units += convert();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << units / iterations << " units out)\n";
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // 4 MiB of header like bytes, every value from 0x00 to 0xFF
+    constexpr std::size_t size = 4 << 20;
+    constexpr std::size_t iterations = 50;
+    std::string text(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) text[i] = static_cast<char>(i * 31);
+    const infra_byte_sequence bytes{text};
+    const infra_string string = infra_string::isomorphic_decode(bytes);
+
+    run("isomorphic_decode", size, iterations, [&] { return infra_string::isomorphic_decode(bytes).size(); });
+    run("isomorphic_encode", size, iterations, [&] { return string.isomorphic_encode().size(); });
+
+    // the same conversions one element at a time, for comparison
+    run("per byte isomorphic_decode", size, iterations / 10, [&]
+    {
+        infra_string decoded;
+        decoded.reserve(bytes.size());
+        for (const auto& byte: bytes) decoded += infra_code_unit{static_cast<std::uint8_t>(byte)};
+        return decoded.size();
+    });
+    run("per code unit isomorphic_encode", size, iterations / 10, [&]
+    {
+        infra_byte_sequence encoded;
+        for (const auto unit: string.code_units()) encoded.push_back(infra_byte{static_cast<std::uint8_t>(static_cast<std::uint16_t>(unit))});
+        return encoded.size();
+    });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& rewrite)
+{
+    std::size_t units = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) units += rewrite();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << units / iterations << " units out)\n";
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // 4 MiB of text with a CR LF pair ending every line, as a text body over the wire would have
+    constexpr std::size_t units = 4 << 20;
+    constexpr std::size_t iterations = 100;
+    std::string text;
+    while (text.size() < units) text += "The quick brown fox jumps over the lazy dog, then naps in the sun.\r\n";
+    text.resize(units);
+
+    const infra_string narrow{text};
+    infra_string wide{text};
+    wide.pop_code_unit();
+    wide += infra_code_unit{0x03B1};
+
+    run("normalize_newlines (one byte)", narrow.size(), iterations, [&] { return narrow.normalize_newlines().size(); });
+    run("normalize_newlines (two byte)", wide.size() * 2, iterations, [&] { return wide.normalize_newlines().size(); });
+    run("strip_newlines (one byte)", narrow.size(), iterations, [&] { return narrow.strip_newlines().size(); });
+    run("strip_newlines (two byte)", wide.size() * 2, iterations, [&] { return wide.strip_newlines().size(); });
+
+    // the in place versions are timed together with the copy they rewrite
+    run("copy (one byte)", narrow.size(), iterations, [&] { return infra_string{narrow}.size(); });
+    run("copy + normalize_newlines_in_place (one byte)", narrow.size(), iterations, [&]
+    {
+        infra_string string{narrow};
+        string.normalize_newlines_in_place();
+        return string.size();
+    });
+
+    // the same rewrite done one code unit at a time, for comparison
+    run("per code unit normalize_newlines (one byte)", narrow.size(), iterations / 10, [&]
+    {
+        infra_string string;
+        string.reserve(narrow.size());
+        const auto units = narrow.code_units();
+        for (std::size_t i = 0; i < units.size(); ++i)
+        {
+            if (units[i] == infra_code_unit{0x000D})
+            {
+                if (i + 1 < units.size() && units[i + 1] == infra_code_unit{0x000A}) ++i;
+                string += infra_code_unit{0x000A};
+            }
+            else string += units[i];
+        }
+        return string.size();
+    });
+    return 0;
+}
\ No newline at end of file
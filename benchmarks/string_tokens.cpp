@@ -0,0 +1,71 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+// counts every heap allocation made while the benchmark runs
+static std::atomic<std::size_t> allocation_count{0};
+
+void* operator new(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc{};
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+template <typename Fn>
+static void run(const char* name, const softloq::whatwg::infra_string& input, const std::size_t iterations, Fn&& split)
+{
+    std::size_t tokens = 0;
+    const std::size_t allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) tokens += split(input);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const std::size_t allocations = allocation_count.load() - allocations_before;
+    std::cout << name << ": " << tokens / iterations << " tokens, "
+              << static_cast<double>(allocations) / tokens << " allocations/token, "
+              << elapsed * 1e9 / tokens << " ns/token\n";
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // a large class attribute and a large comma separated list, the typical inputs of the split algorithms
+    std::string spaces, commas;
+    for (int i = 0; i < 4096; ++i)
+    {
+        const std::string token = "token-" + std::to_string(i % 97);
+        spaces += token + " \t";
+        commas += token + " , ";
+    }
+    const infra_string space_input{spaces};
+    const infra_string comma_input{commas};
+    constexpr std::size_t iterations = 200;
+
+    run("split_spaces", space_input, iterations, [](const infra_string& s) { return s.split_spaces().size(); });
+    run("split_commas", comma_input, iterations, [](const infra_string& s) { return s.split_commas().size(); });
+
+    // the view variants hand out views into the input, so walking every token allocates nothing
+    std::size_t token_units = 0;
+    const auto walk = [&](const infra_string_view::tokens_type& tokens)
+    {
+        std::size_t count = 0;
+        for (const auto token: tokens)
+        {
+            token_units += token.size();
+            ++count;
+        }
+        return count;
+    };
+    run("view split_spaces", space_input, iterations, [&](const infra_string& s) { return walk(infra_string_view{s}.split_spaces()); });
+    run("view split_commas", comma_input, iterations, [&](const infra_string& s) { return walk(infra_string_view{s}.split_commas()); });
+    std::cout << "walked " << token_units << " code units\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& decode)
+{
+    std::size_t units = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) units += decode();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << units / iterations << " units out)\n";
+}
+
+// decodes one code point at a time, as callers had to before the library decoded UTF-8 itself
+static softloq::whatwg::infra_string decode_per_code_point(const std::string& bytes)
+{
+    using namespace softloq::whatwg;
+    infra_string string;
+    for (std::size_t i = 0; i < bytes.size();)
+    {
+        const unsigned char lead = bytes[i];
+        const std::size_t size = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+        std::uint32_t point = size == 1 ? lead : lead & (0x7F >> size);
+        for (std::size_t j = 1; j < size; ++j) point = (point << 6) | (bytes[i + j] & 0x3F);
+        string += infra_code_point{point};
+        i += size;
+    }
+    return string;
+}
+
+// encodes one code point at a time, as quoted_str() used to
+static std::string encode_per_code_point(const softloq::whatwg::infra_string& string)
+{
+    std::string bytes;
+    for (const auto point: string.code_points())
+    {
+        if (point <= 0x007F) bytes += static_cast<char>(point);
+        else if (point <= 0x07FF)
+        {
+            bytes += static_cast<char>(0xC0 + (0x1F & (point >> 6)));
+            bytes += static_cast<char>(0x80 + (0x3F & point));
+        }
+        else if (point <= 0xFFFF)
+        {
+            bytes += static_cast<char>(0xE0 + (0x0F & (point >> 12)));
+            bytes += static_cast<char>(0x80 + (0x3F & (point >> 6)));
+            bytes += static_cast<char>(0x80 + (0x3F & point));
+        }
+        else
+        {
+            bytes += static_cast<char>(0xF0 + (0x07 & (point >> 18)));
+            bytes += static_cast<char>(0x80 + (0x3F & (point >> 12)));
+            bytes += static_cast<char>(0x80 + (0x3F & (point >> 6)));
+            bytes += static_cast<char>(0x80 + (0x3F & point));
+        }
+    }
+    return bytes;
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // 4 MiB of UTF-8 text in each script mix
+    constexpr std::size_t bytes = 4 << 20;
+    constexpr std::size_t iterations = 50;
+    const auto repeat = [](const std::string& line)
+    {
+        std::string text;
+        while (text.size() + line.size() <= bytes) text += line;
+        return text;
+    };
+    const std::string ascii = repeat("The quick brown fox jumps over the lazy dog. ");
+    const std::string latin1 = repeat("Le c\xC5\x93ur d\xC3\xA9\xC3\xA7u mais l'\xC3\xA2me plut\xC3\xB4t na\xC3\xAFve. ");
+    const std::string cjk = repeat("\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ");
+    const std::string emoji = repeat("ok \xF0\x9F\x98\x80 ");
+
+    run("utf8_decode (ASCII)", ascii.size(), iterations, [&] { return infra_string::utf8_decode(ascii).size(); });
+    run("utf8_decode (Latin)", latin1.size(), iterations, [&] { return infra_string::utf8_decode(latin1).size(); });
+    run("utf8_decode (CJK)", cjk.size(), iterations, [&] { return infra_string::utf8_decode(cjk).size(); });
+    run("utf8_decode (emoji)", emoji.size(), iterations, [&] { return infra_string::utf8_decode(emoji).size(); });
+
+    run("per code point decode (ASCII)", ascii.size(), iterations / 10, [&] { return decode_per_code_point(ascii).size(); });
+    run("per code point decode (CJK)", cjk.size(), iterations / 10, [&] { return decode_per_code_point(cjk).size(); });
+
+    // encoding back to UTF-8, reported per byte of UTF-8 output
+    const infra_string ascii_string = infra_string::utf8_decode(ascii);
+    const infra_string cjk_string = infra_string::utf8_decode(cjk);
+    std::string out(cjk.size() > ascii.size() ? cjk.size() : ascii.size(), '\0');
+    run("byte_encoding (ASCII)", ascii.size(), iterations, [&] { return ascii_string.byte_encoding().size(); });
+    run("byte_encoding into a buffer (ASCII)", ascii.size(), iterations, [&] { return ascii_string.byte_encoding(reinterpret_cast<std::uint8_t*>(out.data())); });
+    run("byte_encoding into a buffer (CJK)", cjk.size(), iterations, [&] { return cjk_string.byte_encoding(reinterpret_cast<std::uint8_t*>(out.data())); });
+    run("per code point encode (ASCII)", ascii.size(), iterations / 10, [&] { return encode_per_code_point(ascii_string).size(); });
+    run("per code point encode (CJK)", cjk.size(), iterations / 10, [&] { return encode_per_code_point(cjk_string).size(); });
+    return 0;
+}
\ No newline at end of file
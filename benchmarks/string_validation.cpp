@@ -0,0 +1,61 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t bytes, const std::size_t iterations, Fn&& check)
+{
+    std::size_t passed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) passed += check();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << static_cast<double>(bytes) * iterations / elapsed / 1e9 << " GB/s (" << passed << "/" << iterations << " passed)\n";
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    // 4 MiB of ASCII text, once stored one byte wide and once two bytes wide
+    constexpr std::size_t units = 4 << 20;
+    constexpr std::size_t iterations = 100;
+    std::string text;
+    while (text.size() < units) text += "The quick brown fox jumps over the lazy dog. ";
+    text.resize(units);
+
+    const infra_string narrow{text};
+    infra_string wide{text};
+    // a single unit above 0xFF at the end makes the whole string two bytes wide, and every check scans all of it
+    wide.pop_code_unit();
+    wide += infra_code_unit{0x03B1};
+
+    // text with a surrogate pair every 16 units
+    infra_string pairs;
+    pairs.reserve(units);
+    while (pairs.size() + 16 <= units)
+    {
+        pairs += std::string{"abcdefghijklmn"};
+        pairs += infra_code_point{0x1F600};
+    }
+
+    run("is_ascii (one byte)", narrow.size(), iterations, [&] { return narrow.is_ascii(); });
+    run("is_ascii (two byte)", wide.size() * 2, iterations, [&] { return !wide.is_ascii(); });
+    run("is_isomorphic (two byte)", wide.size() * 2, iterations, [&] { return !wide.is_isomorphic(); });
+    run("is_scalar (two byte)", wide.size() * 2, iterations, [&] { return wide.is_scalar(); });
+    run("is_scalar (surrogate pairs)", pairs.size() * 2, iterations, [&] { return pairs.is_scalar(); });
+
+    // the same checks done one code point at a time, for comparison
+    run("per code point is_ascii (one byte)", narrow.size(), iterations / 10, [&]
+    {
+        for (const auto point: narrow.code_points()) if (!point.is_ascii()) return false;
+        return true;
+    });
+    run("per code point is_scalar (surrogate pairs)", pairs.size() * 2, iterations / 10, [&]
+    {
+        for (const auto point: pairs.code_points()) if (point.is_surrogate()) return false;
+        return true;
+    });
+    return 0;
+}
\ No newline at end of file
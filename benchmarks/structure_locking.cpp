@@ -0,0 +1,54 @@
+#include <softloq/whatwg/infra.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+template <typename Fn>
+static void run(const char* name, const std::size_t items, const std::size_t iterations, Fn&& work)
+{
+    std::uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) sum += work();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << elapsed / (items * iterations) * 1e9 << " ns per item (" << sum / iterations << ")" << std::endl;
+}
+
+// one thread appending and indexing item by item, as byte sequences are built and read
+template <class Lock>
+static void compare(const char* policy)
+{
+    using namespace softloq::whatwg;
+    constexpr std::size_t items = 1 << 20;
+    std::cout << policy << std::endl;
+
+    infra_sequence<std::uint8_t, Lock> sequence;
+    run("  sequence push_back", items, 8, [&]
+    {
+        sequence.clear();
+        for (std::size_t i = 0; i < items; ++i) sequence.push_back(static_cast<std::uint8_t>(i));
+        return static_cast<std::uint64_t>(sequence.size());
+    });
+    run("  sequence operator[]", items, 8, [&]
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < items; ++i) sum += sequence[i];
+        return sum;
+    });
+    run("  list append", items, 8, [&]
+    {
+        infra_list<std::uint32_t, std::deque<std::uint32_t>, Lock> list;
+        for (std::uint32_t i = 0; i < items; ++i) list.append(i);
+        return static_cast<std::uint64_t>(list.size());
+    });
+}
+
+int main()
+{
+    using namespace softloq::whatwg;
+
+    compare<infra_no_lock>("infra_no_lock");
+    compare<infra_mutex_lock>("infra_mutex_lock");
+    compare<infra_shared_mutex_lock>("infra_shared_mutex_lock");
+    return 0;
+}
\ No newline at end of file
@@ -9,5 +9,6 @@
 
 #include "softloq/whatwg/infra/primitive.hpp"
 #include "softloq/whatwg/infra/structure.hpp"
+#include "softloq/whatwg/infra/json.hpp"
 
 #endif
\ No newline at end of file
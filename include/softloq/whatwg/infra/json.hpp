@@ -0,0 +1,15 @@
+/**
+ * @file json.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief All of the WHATWG infra JSON classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_HPP
+
+#include "softloq/whatwg/infra/json/value.hpp"
+#include "softloq/whatwg/infra/json/document.hpp"
+#include "softloq/whatwg/infra/json/serializer.hpp"
+#include "softloq/whatwg/infra/json/lazy.hpp"
+
+#endif
\ No newline at end of file
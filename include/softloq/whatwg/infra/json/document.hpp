@@ -0,0 +1,68 @@
+/**
+ * @file document.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra JSON document class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_DOCUMENT_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_DOCUMENT_HPP
+
+#include "softloq/whatwg/infra/json/value.hpp"
+
+#include <memory>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Parsed JSON whose lists and maps all live in one arena, so that the whole value is freed at once instead of node by node.
+ * The arena keeps its memory between parses and grows to fit the largest document parsed, so parsing many documents of a similar size
+ * into one document stops allocating for them. The root and everything in it stays valid until the next parse or the destruction of the
+ * document; copy a value to keep it longer. */
+class infra_json_document final
+{
+public:
+    // constructors //
+
+    /** @brief Constructs an empty WHATWG infra JSON document whose root is null. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_document() noexcept;
+    infra_json_document(const infra_json_document& src) = delete;
+    /** 
+     * @brief Constructs a WHATWG infra JSON document from another infra JSON document.
+     * @param src The infra JSON document that will be moved. Its root stays valid in the new document, and it is left with a null root. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_document(infra_json_document&& src) noexcept;
+    /** @brief Default destructor. */
+    SOFTLOQ_WHATWG_INFRA_API ~infra_json_document() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_json_document& operator=(const infra_json_document& src) = delete;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_document& operator=(infra_json_document&& src) noexcept;
+
+    //-------------//
+
+    // WHATWG JSON document member functions //
+
+    /**
+     * @brief Parses UTF-8 JSON bytes into the document, freeing the previous root. A leading byte order mark is removed.
+     * @return False if the bytes are not JSON, leaving a null root. */
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const infra_byte_sequence& bytes) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const std::string& bytes) noexcept;
+    /** @brief Parses a JSON string into the document, freeing the previous root. Returns false if the string is not JSON, leaving a null root. */
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const infra_string& string) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const infra_json_value& root() const noexcept;
+
+    //---------------------------------------//
+
+private:
+    struct arena_resource;
+    std::unique_ptr<arena_resource> arena;
+    // declared after the arena so that it is destroyed first
+    infra_json_value value;
+
+    std::pmr::memory_resource* reset() noexcept;
+};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ * @file lazy.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra JSON lazy document and value classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_LAZY_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_LAZY_HPP
+
+#include "softloq/whatwg/infra/json/value.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace softloq::whatwg
+{
+class infra_json_lazy_document;
+
+/**
+ * @brief A value of a lazy JSON document. Nothing is read from the text until it is asked for: strings and numbers are made when their
+ * accessor is called, and finding a map entry or list item skips whole subtrees without looking into them. The value stays valid until
+ * the next parse or the destruction of its document. */
+class infra_json_lazy_value final
+{
+public:
+    // common member types //
+
+    /** @brief Walks the items of a list or the entries of a map, in the order of the text. A repeated key is visited once per entry. */
+    class const_iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = infra_json_lazy_value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = infra_json_lazy_value;
+
+        SOFTLOQ_WHATWG_INFRA_API const_iterator() noexcept;
+        /** @brief Returns the list item, or the value of the map entry. */
+        SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value operator*() const noexcept;
+        /** @brief Returns the key of the map entry, or std::nullopt for a list item or a key that is not a valid JSON string. */
+        SOFTLOQ_WHATWG_INFRA_API std::optional<infra_string> key() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator& operator++() noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator operator++(int) noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const bool operator==(const const_iterator& b) const noexcept;
+
+    private:
+        friend class infra_json_lazy_value;
+        const infra_json_lazy_document* document;
+        std::uint32_t index;
+        bool map;
+
+        SOFTLOQ_WHATWG_INFRA_API const_iterator(const infra_json_lazy_document* document, const std::uint32_t index, const bool map) noexcept;
+    };
+
+    //---------------------//
+
+    // WHATWG JSON lazy value member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API const infra_json_type type() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_null() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_bool() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_number() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_string() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_list() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_map() const noexcept;
+
+    /**
+     * @brief The accessors read the value from the text. They return std::nullopt if the value is of another type, or if it is not valid
+     * JSON: the document checks the structure of the text when it is parsed, and each string, number and literal when it is read. */
+    SOFTLOQ_WHATWG_INFRA_API std::optional<bool> as_bool() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::optional<double> as_number() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_string> as_string() const noexcept;
+
+    /** @brief Returns the number of list items or map entries, counting repeated keys, or 0 if the value is neither. */
+    SOFTLOQ_WHATWG_INFRA_API const std::size_t size() const noexcept;
+    /** @brief Returns the list item at the index, or std::nullopt if the value is not a list or is too short. */
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_lazy_value> at(const std::size_t index) const noexcept;
+    /** @brief Returns the value of the last map entry with the key, as parsing keeps it, or std::nullopt if the value is not a map or has no such entry. */
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_lazy_value> find(const infra_string_view& key) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator begin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator end() const noexcept;
+
+    /** @brief Parses the whole value into an infra JSON value, or returns std::nullopt if any part of it is not valid JSON. */
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_value> materialize() const noexcept;
+
+    //-----------------------------------------//
+
+private:
+    friend class infra_json_lazy_document;
+    const infra_json_lazy_document* document;
+    std::uint32_t index;
+
+    SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value(const infra_json_lazy_document* document, const std::uint32_t index) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* text() const noexcept;
+};
+
+/**
+ * @brief JSON text that is only indexed when it is parsed. Parsing keeps the text, copied or taken over, and a tape with one entry per value, key and
+ * closing bracket, each holding where the token starts and, for lists and maps, where the entry after the whole subtree is. No infra string,
+ * list or map is made until a value is read, so reading a few fields of a large document costs little more than indexing it. */
+class infra_json_lazy_document final
+{
+public:
+    // constructors //
+
+    /** @brief Constructs an empty WHATWG infra JSON lazy document whose root is null. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document() noexcept;
+    infra_json_lazy_document(const infra_json_lazy_document& src) = delete;
+    /**
+     * @brief Constructs a WHATWG infra JSON lazy document from another infra JSON lazy document.
+     * @param src The infra JSON lazy document that will be moved. It is left with a null root. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document(infra_json_lazy_document&& src) noexcept;
+    /** @brief Default destructor. */
+    SOFTLOQ_WHATWG_INFRA_API ~infra_json_lazy_document() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_json_lazy_document& operator=(const infra_json_lazy_document& src) = delete;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document& operator=(infra_json_lazy_document&& src) noexcept;
+
+    //-------------//
+
+    // WHATWG JSON lazy document member functions //
+
+    /**
+     * @brief Indexes UTF-8 JSON bytes into the document. A leading byte order mark is removed.
+     * @return False if the brackets, commas and colons of the bytes do not form JSON, the first byte of a token cannot start a value,
+     * or lists and maps nest more than 1024 deep, leaving a null root. */
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const infra_byte_sequence& bytes) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const std::string& bytes) noexcept;
+    /** @brief Indexes UTF-8 JSON bytes into the document, taking them over instead of copying them. */
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(std::string&& bytes) noexcept;
+    /** @brief Indexes a JSON string into the document. The string is read as UTF-8, so a lone surrogate becomes U+FFFD. */
+    SOFTLOQ_WHATWG_INFRA_API const bool parse(const infra_string& string) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value root() const noexcept;
+
+    //--------------------------------------------//
+
+private:
+    friend class infra_json_lazy_value;
+    friend class infra_json_lazy_value::const_iterator;
+    /** @brief Offset of the token, and the tape position after it: past the closing bracket for a list or map, the next entry otherwise. */
+    struct tape_entry
+    {
+        std::uint32_t offset;
+        std::uint32_t next;
+    };
+    std::string text;
+    // kept between parses, and only as large as the most structural bytes indexed so far
+    std::unique_ptr<tape_entry[]> tape;
+    std::size_t tape_capacity = 0;
+
+    SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* bytes() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool index() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void reset() noexcept;
+};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+/**
+ * @file serializer.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra JSON serializer and sink classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_SERIALIZER_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_SERIALIZER_HPP
+
+#include "softloq/whatwg/infra/json/value.hpp"
+#include "softloq/whatwg/infra/primitive/number.hpp"
+#include "softloq/whatwg/infra/structure/list.hpp"
+
+namespace softloq::whatwg
+{
+/** @brief Destination of serialized JSON, which receives the bytes in chunks of up to infra_json_serializer::chunk_size. */
+class infra_json_sink
+{
+public:
+    /** @brief Default destructor. */
+    SOFTLOQ_WHATWG_INFRA_API virtual ~infra_json_sink() noexcept;
+
+    /** @brief Receives the next chunk of bytes. */
+    virtual void write(const std::uint8_t* bytes, const std::size_t count) noexcept = 0;
+};
+
+/**
+ * @brief Serializer of infra values to JSON bytes (https://infra.spec.whatwg.org/#serialize-an-infra-value-to-json-bytes), formatted the way
+ * JSON.stringify does. The bytes are buffered and flushed a chunk at a time, so a large value can be written piece by piece with the list and map
+ * functions without ever being built whole. Strings are scanned for the code units that need escaping by a vectorized kernel, and the runs
+ * between them are UTF-8 encoded at once. Lists and maps must be closed in the order they were opened; nothing checks it. */
+class infra_json_serializer final
+{
+public:
+    /** @brief The number of bytes buffered before they are flushed. */
+    static constexpr std::size_t chunk_size = 16 << 10;
+
+    // constructors //
+
+    /**
+     * @brief Constructs a WHATWG infra JSON serializer that appends to a byte sequence.
+     * @param out The byte sequence, which must outlive the serializer. */
+    SOFTLOQ_WHATWG_INFRA_API explicit infra_json_serializer(infra_byte_sequence& out) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra JSON serializer that writes to a sink.
+     * @param sink The sink, which must outlive the serializer. */
+    SOFTLOQ_WHATWG_INFRA_API explicit infra_json_serializer(infra_json_sink& sink) noexcept;
+    infra_json_serializer(const infra_json_serializer& src) = delete;
+    /** @brief Flushes the bytes still buffered. */
+    SOFTLOQ_WHATWG_INFRA_API ~infra_json_serializer() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_json_serializer& operator=(const infra_json_serializer& src) = delete;
+
+    //-------------//
+
+    // WHATWG JSON serializer member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_json_value& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_null& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_bool& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void write(const bool value) noexcept;
+    /** @brief Writes the shortest digits that read back as the number. NaN and the infinities are written as null, as JSON.stringify does. */
+    SOFTLOQ_WHATWG_INFRA_API void write(const double value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_number_base& value) noexcept;
+    /** @brief Writes a string, escaping each lone surrogate as JSON.stringify does instead of replacing it. */
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_string_view& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void write(const infra_string& value) noexcept;
+    template <class T, class Container, class Lock> void write(const infra_list<T, Container, Lock>& value) noexcept;
+    /** @brief Pointers would otherwise convert to a boolean. */
+    void write(const void* value) = delete;
+
+    SOFTLOQ_WHATWG_INFRA_API void begin_list() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void end_list() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void begin_map() noexcept;
+    /** @brief Writes the key of the next map entry, whose value is written next. */
+    SOFTLOQ_WHATWG_INFRA_API void key(const infra_string_view& key) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void end_map() noexcept;
+
+    /** @brief Hands the buffered bytes to the byte sequence or sink. */
+    SOFTLOQ_WHATWG_INFRA_API void flush() noexcept;
+
+    //-----------------------------------------//
+
+private:
+    infra_byte_sequence* out;
+    infra_json_sink* sink;
+    std::size_t used;
+    // whether a comma goes before the next value
+    bool separate;
+    std::uint8_t buffer[chunk_size];
+
+    SOFTLOQ_WHATWG_INFRA_API void separator() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void put_byte(const std::uint8_t byte) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void put(const std::uint8_t* bytes, const std::size_t count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void put_string(const std::uint8_t* units, const std::size_t count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void put_string(const std::uint16_t* units, const std::size_t count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void put_escape(const std::uint16_t unit) noexcept;
+};
+}
+
+#include "softloq/whatwg/infra/json/serializer.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ * @file serializer.tpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Template implementation of the WHATWG infra JSON serializer class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/json/serializer.hpp"
+
+namespace softloq::whatwg
+{
+// WHATWG JSON serializer member functions //
+
+template <class T, class Container, class Lock> void infra_json_serializer::write(const infra_list<T, Container, Lock>& value) noexcept
+{
+    begin_list();
+    for (const T& item: value) write(item);
+    end_list();
+}
+
+//-----------------------------------------//
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**
+ * @file value.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra JSON value class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_VALUE_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_VALUE_HPP
+
+#include "softloq/whatwg/infra/primitive/null.hpp"
+#include "softloq/whatwg/infra/primitive/bool.hpp"
+#include "softloq/whatwg/infra/primitive/byte_sequence.hpp"
+#include "softloq/whatwg/infra/primitive/string.hpp"
+
+#include <memory_resource>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace softloq::whatwg
+{
+class infra_json_sink;
+
+/** @brief WHATWG infra JSON value types */
+enum class infra_json_type { infra_null, infra_bool, infra_number, infra_string, infra_list, infra_map };
+
+/**
+ * @brief WHATWG infra value parsed from JSON (https://infra.spec.whatwg.org/#parse-a-json-string-to-an-infra-value): null, a boolean,
+ * a number, a string, a list of values, or an ordered map of strings to values.
+ * The list and map storage comes from a memory resource, the default one unless the value was parsed by an infra_json_document.
+ * A copy always uses the default resource. */
+class infra_json_value final
+{
+public:
+    // common member types //
+
+    using list_type = std::pmr::vector<infra_json_value>;
+    using entry_type = std::pair<infra_string, infra_json_value>;
+    using map_type = std::pmr::vector<entry_type>;
+
+    //---------------------//
+
+    // constructors //
+
+    /** @brief Constructs a WHATWG infra JSON null. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const infra_null& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const infra_bool& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const bool value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const double value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const infra_string& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(infra_string&& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const list_type& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(list_type&& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const map_type& value) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(map_type&& value) noexcept;
+    /** @brief Pointers would otherwise convert to a boolean. */
+    infra_json_value(const void* value) = delete;
+    /** 
+     * @brief Constructs a WHATWG infra JSON value from another infra JSON value.
+     * @param src The infra JSON value that will be copied. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(const infra_json_value& src) noexcept;
+    /** 
+     * @brief Constructs a WHATWG infra JSON value from another infra JSON value.
+     * @param src The infra JSON value that will be moved. Lists and maps keep their memory resource. */
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value(infra_json_value&& src) noexcept;
+    /** @brief Default destructor. */
+    SOFTLOQ_WHATWG_INFRA_API ~infra_json_value() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value& operator=(const infra_json_value& src) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_json_value& operator=(infra_json_value&& src) noexcept;
+
+    //-------------//
+
+    // WHATWG JSON value member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API const infra_json_type type() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_null() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_bool() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_number() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_string() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_list() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_map() const noexcept;
+
+    /** @brief The accessors require the value to be of their type. */
+    SOFTLOQ_WHATWG_INFRA_API const bool as_bool() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const double as_number() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const infra_string& as_string() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API list_type& as_list() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const list_type& as_list() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API map_type& as_map() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const map_type& as_map() const noexcept;
+
+    /** @brief Returns the value of the map entry with the key, or nullptr if the value is not a map or has no such entry. */
+    SOFTLOQ_WHATWG_INFRA_API const infra_json_value* find(const infra_string_view& key) const noexcept;
+
+    //------------------------------------//
+
+    // WHATWG JSON parsing functions //
+
+    /**
+     * @brief Parses UTF-8 JSON bytes (https://infra.spec.whatwg.org/#parse-json-bytes-to-an-infra-value). A leading byte order mark is removed.
+     * Objects become ordered maps in which a repeated key keeps its first position and its last value.
+     * Parsing reuses buffers of the calling thread, the largest an index of up to 4 bytes per structural byte of the text. They are kept for the
+     * next parse on the thread while at most 1 MiB each, and freed after the parse otherwise.
+     * @return The value, or std::nullopt if the bytes are not JSON or nest lists and maps more than 1024 deep. */
+    SOFTLOQ_WHATWG_INFRA_API static std::optional<infra_json_value> parse(const infra_byte_sequence& bytes) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API static std::optional<infra_json_value> parse(const std::string& bytes) noexcept;
+    /** @brief Parses a JSON string (https://infra.spec.whatwg.org/#parse-a-json-string-to-an-infra-value). The string is read as UTF-8, so a lone surrogate becomes U+FFFD. */
+    SOFTLOQ_WHATWG_INFRA_API static std::optional<infra_json_value> parse(const infra_string& string) noexcept;
+
+    //-------------------------------//
+
+    // WHATWG JSON serializing functions //
+
+    /** @brief Serializes the value to JSON bytes (https://infra.spec.whatwg.org/#serialize-an-infra-value-to-json-bytes), as JSON.stringify does. */
+    SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence serialize() const noexcept;
+    /** @brief Serializes the value to JSON bytes, handing them to the sink in chunks instead of holding them all. */
+    SOFTLOQ_WHATWG_INFRA_API void serialize(infra_json_sink& sink) const noexcept;
+
+    //-----------------------------------//
+
+    // WHATWG JSON value comparison functions //
+
+    /** @brief Compares the type and contents. Maps are equal when their entries are equal in order. */
+    SOFTLOQ_WHATWG_INFRA_API const bool operator==(const infra_json_value& b) const noexcept;
+
+    //----------------------------------------//
+
+private:
+    infra_json_type value_type;
+    union
+    {
+        bool boolean;
+        double number;
+        infra_string string;
+        list_type list;
+        map_type map;
+    };
+
+    SOFTLOQ_WHATWG_INFRA_API void destroy() noexcept;
+};
+}
+
+#endif
\ No newline at end of file
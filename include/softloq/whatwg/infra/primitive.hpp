@@ -15,6 +15,8 @@
 #include "softloq/whatwg/infra/primitive/code_unit.hpp"
 #include "softloq/whatwg/infra/primitive/code_point.hpp"
 #include "softloq/whatwg/infra/primitive/string.hpp"
+#include "softloq/whatwg/infra/primitive/string_view.hpp"
+#include "softloq/whatwg/infra/primitive/base64.hpp"
 #include "softloq/whatwg/infra/primitive/time.hpp"
 
 #endif
\ No newline at end of file
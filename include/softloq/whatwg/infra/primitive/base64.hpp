@@ -0,0 +1,86 @@
+/**
+ * @file base64.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra forgiving-base64 streaming encoder and decoder classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_BASE64_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_BASE64_HPP
+
+#include "softloq/whatwg/infra/primitive/byte_sequence.hpp"
+#include "softloq/whatwg/infra/primitive/string.hpp"
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Forgiving-base64 encoder (https://infra.spec.whatwg.org/#forgiving-base64-encode) for data that arrives in chunks.
+ * Up to two bytes of a chunk are held back until the next chunk completes their group, so the output matches encoding the joined chunks at once. */
+class infra_base64_encoder final
+{
+public:
+    // constructors //
+
+    /** @brief Constructs a WHATWG infra base64 encoder with no bytes held back. */
+    SOFTLOQ_WHATWG_INFRA_API infra_base64_encoder() noexcept;
+
+    //--------------//
+
+    // encoder member functions //
+
+    /**
+     * @brief Encodes a chunk of data.
+     * @param data The chunk of data.
+     * @param out The string the characters are appended to. */
+    SOFTLOQ_WHATWG_INFRA_API void encode(const infra_byte_sequence& data, infra_string& out) noexcept;
+    /**
+     * @brief Encodes the bytes held back with padding and resets the encoder.
+     * @param out The string the characters are appended to. */
+    SOFTLOQ_WHATWG_INFRA_API void finish(infra_string& out) noexcept;
+
+    //--------------------------//
+
+private:
+    std::uint8_t pending[3];
+    std::size_t pending_size;
+
+    SOFTLOQ_WHATWG_INFRA_API void write(const std::uint8_t* bytes, const std::size_t count, infra_string& out) noexcept;
+};
+
+/**
+ * @brief Forgiving-base64 decoder (https://infra.spec.whatwg.org/#forgiving-base64-decode) for characters that arrive in chunks.
+ * ASCII whitespace is skipped and a partial group of characters is carried between chunks, so chunks may be split anywhere. */
+class infra_base64_decoder final
+{
+public:
+    // constructors //
+
+    /** @brief Constructs a WHATWG infra base64 decoder with no characters carried. */
+    SOFTLOQ_WHATWG_INFRA_API infra_base64_decoder() noexcept;
+
+    //--------------//
+
+    // decoder member functions //
+
+    /**
+     * @brief Decodes a chunk of characters.
+     * @param data The chunk of characters.
+     * @param out The byte sequence the decoded bytes are appended to.
+     * @return False if this or an earlier chunk is not valid base64. */
+    SOFTLOQ_WHATWG_INFRA_API const bool decode(const infra_string_view& data, infra_byte_sequence& out) noexcept;
+    /**
+     * @brief Decodes the characters carried with the padding seen and resets the decoder.
+     * @param out The byte sequence the decoded bytes are appended to.
+     * @return False if the joined chunks are not valid base64. */
+    SOFTLOQ_WHATWG_INFRA_API const bool finish(infra_byte_sequence& out) noexcept;
+
+    //--------------------------//
+
+private:
+    std::uint32_t bits;
+    std::uint32_t sextets;
+    std::uint32_t padding;
+    bool failed;
+};
+}
+
+#endif
\ No newline at end of file
@@ -9,16 +9,18 @@
 
 #include "softloq/whatwg/infra/primitive/uint.hpp"
 
+#include <type_traits>
+
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra byte primitive class (https://infra.spec.whatwg.org/#bytes). */
-class infra_byte final: public infra_primitive_base
+class infra_byte final
 {
 public:
     // constructors //
 
     /** @brief Constructs a WHATWG infra byte with a default value of 0x00. */
-    SOFTLOQ_WHATWG_INFRA_API infra_byte() noexcept;
+    infra_byte() noexcept = default;
     /** 
      * @brief Constructs a WHATWG infra byte with a specified 32-bit signed integer value.
      * @param value The initial value. Will be converted to an 8-bit unsigned integer via underflow/overflow. */
@@ -34,13 +36,13 @@ public:
     /** 
      * @brief Constructs a WHATWG infra byte from another infra byte.
      * @param value The infra byte that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_byte(const infra_byte& src) noexcept;
+    infra_byte(const infra_byte& src) noexcept = default;
     /** 
      * @brief Constructs a WHATWG infra byte from another infra byte.
      * @param value The infra byte that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_byte(infra_byte&& src) noexcept;
+    infra_byte(infra_byte&& src) noexcept = default;
     /** @brief Default destructor. */
-    SOFTLOQ_WHATWG_INFRA_API ~infra_byte() noexcept;
+    ~infra_byte() noexcept = default;
 
     //--------------//
 
@@ -60,11 +62,11 @@ public:
     /** 
      * @brief Assigns the WHATWG infra byte from another infra byte.
      * @param value The infra byte that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_byte& operator=(const infra_byte& src) noexcept;
+    infra_byte& operator=(const infra_byte& src) noexcept = default;
     /** 
      * @brief Assigns the WHATWG infra byte from another infra byte.
      * @param value The infra byte that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_byte& operator=(infra_byte&& src) noexcept;
+    infra_byte& operator=(infra_byte&& src) noexcept = default;
 
     //-------------//
 
@@ -77,20 +79,23 @@ public:
 
     //-------------//
 
-    // WHATWG primitive base overrides //
+    // WHATWG primitive functions //
 
     /** @brief Returns the primitive type of the class: infra_primitive_type::infra_byte. */
-    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept;
     /**
      * @brief Default ostream representation of the WHATWG infra byte primitive.
      * @param out The ostream instance. */
-    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API friend std::ostream& operator<<(std::ostream& out, const infra_byte& byte) noexcept;
 
-    //---------------------------------//
+    //----------------------------//
     
 private:
-    infra_uint8 data;
+    std::uint8_t data = 0x00;
 };
+
+static_assert(sizeof(infra_byte) == 1 && std::is_trivially_copyable_v<infra_byte> && std::is_standard_layout_v<infra_byte>);
 }
 
 #endif
\ No newline at end of file
@@ -14,14 +14,16 @@
 
 namespace softloq::whatwg
 {
-/** @brief WHATWG infra byte sequence primitive class (https://infra.spec.whatwg.org/#byte-sequences). Inheritly thread-safe. */
-class infra_byte_sequence final: public infra_sequence<infra_byte>, public infra_primitive_base
+/**
+ * @brief WHATWG infra byte sequence primitive class (https://infra.spec.whatwg.org/#byte-sequences). Like infra_string, it takes no lock, so that
+ * appending a byte does not cost an atomic read-modify-write; a byte sequence shared between threads has to be guarded by its user. */
+class infra_byte_sequence final: public infra_sequence<infra_byte, infra_no_lock>, public infra_primitive_base
 {
 public:
     // common member types //
 
     /** @brief The sequence type that is used internally. */
-    using sequence_type = infra_sequence<infra_byte>;
+    using sequence_type = infra_sequence<infra_byte, infra_no_lock>;
 
     //---------------------//
 
@@ -85,6 +87,10 @@ public:
     SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence lowercase() const noexcept;
     /** @brief Returns the byte sequence in ascii uppercase format. */
     SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence uppercase() const noexcept;
+    /** @brief Converts the byte sequence to ascii lowercase format in place, reusing its storage. */
+    SOFTLOQ_WHATWG_INFRA_API void lowercase_in_place() noexcept;
+    /** @brief Converts the byte sequence to ascii uppercase format in place, reusing its storage. */
+    SOFTLOQ_WHATWG_INFRA_API void uppercase_in_place() noexcept;
 
     //-------------------------//
 
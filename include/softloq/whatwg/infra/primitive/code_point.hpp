@@ -9,10 +9,12 @@
 
 #include "softloq/whatwg/infra/primitive/uint.hpp"
 
+#include <type_traits>
+
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra code point primitive class (https://infra.spec.whatwg.org/#code-points). */
-class infra_code_point final: public infra_primitive_base
+class infra_code_point final
 {
 public:
     // constructors //
@@ -34,13 +36,13 @@ public:
     /** 
      * @brief Constructs a WHATWG infra code point from another infra code point.
      * @param value The infra code point that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_point(const infra_code_point& src) noexcept;
+    infra_code_point(const infra_code_point& src) noexcept = default;
     /** 
      * @brief Constructs a WHATWG infra code point from another infra code point.
      * @param value The infra code point that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_point(infra_code_point&& src) noexcept;
+    infra_code_point(infra_code_point&& src) noexcept = default;
     /** @brief Default destructor. */
-    SOFTLOQ_WHATWG_INFRA_API ~infra_code_point() noexcept;
+    ~infra_code_point() noexcept = default;
 
     //--------------//
 
@@ -61,11 +63,11 @@ public:
     /** 
      * @brief Assigns the WHATWG infra code point from another infra code point.
      * @param value The infra code point that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_point& operator=(const infra_code_point& src) noexcept;
+    infra_code_point& operator=(const infra_code_point& src) noexcept = default;
     /** 
      * @brief Assigns the WHATWG infra code point from another infra code point.
      * @param value The infra code point that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_point& operator=(infra_code_point&& src) noexcept;
+    infra_code_point& operator=(infra_code_point&& src) noexcept = default;
 
     //-------------//
 
@@ -132,20 +134,24 @@ public:
 
     //------------------------------------//
 
-    // WHATWG primitive base overrides //
+    // WHATWG primitive functions //
 
     /** @brief Returns the primitive type of the class: infra_primitive_type::infra_code_point. */
-    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept;
     /**
      * @brief Default ostream representation of the WHATWG infra code point primitive.
      * @param out The ostream instance. */
-    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept;
+    /** @brief Enables output stream behavior. */
+    SOFTLOQ_WHATWG_INFRA_API friend std::ostream& operator<<(std::ostream& out, const infra_code_point& point) noexcept;
 
-    //---------------------------------//
+    //----------------------------//
     
 private:
-    infra_uint32 data;
+    std::uint32_t data;
 };
+
+static_assert(sizeof(infra_code_point) == 4 && std::is_trivially_copyable_v<infra_code_point> && std::is_standard_layout_v<infra_code_point>);
 }
 
 #endif
\ No newline at end of file
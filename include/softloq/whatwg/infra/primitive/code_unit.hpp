@@ -9,10 +9,12 @@
 
 #include "softloq/whatwg/infra/primitive/uint.hpp"
 
+#include <type_traits>
+
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra code unit primitive class (https://infra.spec.whatwg.org/#strings). */
-class infra_code_unit final: public infra_primitive_base
+class infra_code_unit final
 {
 public:
     // constructors //
@@ -34,13 +36,13 @@ public:
     /** 
      * @brief Constructs a WHATWG infra code unit from another infra code unit.
      * @param value The infra code unit that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_unit(const infra_code_unit& src) noexcept;
+    infra_code_unit(const infra_code_unit& src) noexcept = default;
     /** 
      * @brief Constructs a WHATWG infra code unit from another infra code unit.
      * @param value The infra code unit that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_unit(infra_code_unit&& src) noexcept;
+    infra_code_unit(infra_code_unit&& src) noexcept = default;
     /** @brief Default destructor. */
-    SOFTLOQ_WHATWG_INFRA_API ~infra_code_unit() noexcept;
+    ~infra_code_unit() noexcept = default;
 
     //--------------//
 
@@ -61,11 +63,11 @@ public:
     /** 
      * @brief Assigns the WHATWG infra code unit from another infra code unit.
      * @param value The infra code unit that will be copied. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_unit& operator=(const infra_code_unit& src) noexcept;
+    infra_code_unit& operator=(const infra_code_unit& src) noexcept = default;
     /** 
      * @brief Assigns the WHATWG infra code unit from another infra code unit.
      * @param value The infra code unit that will be moved. */
-    SOFTLOQ_WHATWG_INFRA_API infra_code_unit& operator=(infra_code_unit&& src) noexcept;
+    infra_code_unit& operator=(infra_code_unit&& src) noexcept = default;
 
     //-------------//
 
@@ -124,20 +126,24 @@ public:
 
     //-----------------------------------//
 
-    // WHATWG primitive base overrides //
+    // WHATWG primitive functions //
 
     /** @brief Returns the primitive type of the class: infra_primitive_type::infra_code_unit. */
-    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type primitive_type() const noexcept;
     /**
      * @brief Default ostream representation of the WHATWG infra code unit primitive.
      * @param out The ostream instance. */
-    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept override;
+    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept;
+    /** @brief Enables output stream behavior. */
+    SOFTLOQ_WHATWG_INFRA_API friend std::ostream& operator<<(std::ostream& out, const infra_code_unit& unit) noexcept;
 
-    //---------------------------------//
+    //----------------------------//
 
 private:
-    infra_uint16 data;
+    std::uint16_t data;
 };
+
+static_assert(sizeof(infra_code_unit) == 2 && std::is_trivially_copyable_v<infra_code_unit> && std::is_standard_layout_v<infra_code_unit>);
 }
 
 #endif
\ No newline at end of file
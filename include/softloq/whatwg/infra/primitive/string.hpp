@@ -14,33 +14,188 @@
 
 #include <initializer_list>
 #include <functional>
+#include <iterator>
+#include <compare>
+#include <optional>
 
 namespace softloq::whatwg
 {
+class infra_string_view;
+
 /** @brief WHATWG infra string primitive class (https://infra.spec.whatwg.org/#strings). */
 class infra_string final: public infra_primitive_base
 {
 public:
 
+    // code unit view //
+
+    /** @brief Read-only view over the code units of a string. The units are stored either one byte (Latin-1) or two bytes (UTF-16) wide. */
+    class code_unit_view
+    {
+    public:
+        using value_type = infra_code_unit;
+        using size_type = std::size_t;
+
+        /** @brief Random access iterator that yields the code units by value, independent of the storage width. */
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = infra_code_unit;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = infra_code_unit;
+
+            SOFTLOQ_WHATWG_INFRA_API const_iterator() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator(const void* units, const bool wide, const difference_type pos) noexcept;
+
+            SOFTLOQ_WHATWG_INFRA_API reference operator*() const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API reference operator[](const difference_type n) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator++() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator++(int) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator--() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator--(int) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator+=(const difference_type n) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator-=(const difference_type n) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator+(const difference_type n) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator-(const difference_type n) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API difference_type operator-(const const_iterator& b) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const bool operator==(const const_iterator& b) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API std::strong_ordering operator<=>(const const_iterator& b) const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API friend const_iterator operator+(const difference_type n, const const_iterator& it) noexcept;
+
+        private:
+            const void* units;
+            bool wide;
+            difference_type pos;
+        };
+        using iterator = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator = const_reverse_iterator;
+
+        SOFTLOQ_WHATWG_INFRA_API code_unit_view() noexcept;
+        SOFTLOQ_WHATWG_INFRA_API code_unit_view(const void* units, const size_type length, const bool wide) noexcept;
+
+        SOFTLOQ_WHATWG_INFRA_API const_iterator begin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator cbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator end() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator cend() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rend() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crend() const noexcept;
+
+        SOFTLOQ_WHATWG_INFRA_API infra_code_unit front() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API infra_code_unit back() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const size_type size() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const bool empty() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API infra_code_unit operator[](const size_type index) const noexcept;
+
+        /** @brief Checks if the code units are stored two bytes wide. */
+        SOFTLOQ_WHATWG_INFRA_API const bool is_wide() const noexcept;
+        /** @brief Returns the one byte code units. Only meaningful if the view is not wide. */
+        SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* latin1_data() const noexcept;
+        /** @brief Returns the two byte code units. Only meaningful if the view is wide. */
+        SOFTLOQ_WHATWG_INFRA_API const std::uint16_t* utf16_data() const noexcept;
+
+    private:
+        const void* units;
+        size_type length;
+        bool wide;
+    };
+
+    //----------------//
+
+    // code point view //
+
+    /** @brief Read-only view over the code units of a string that decodes code points on demand. Surrogate pairs are combined, lone surrogates are kept as is. */
+    class code_point_view
+    {
+    public:
+        using value_type = infra_code_point;
+        using size_type = std::size_t;
+
+        /** @brief Bidirectional iterator that yields the decoded code points by value. */
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = infra_code_point;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = infra_code_point;
+
+            SOFTLOQ_WHATWG_INFRA_API const_iterator() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator(const void* units, const size_type length, const bool wide, const size_type pos) noexcept;
+
+            SOFTLOQ_WHATWG_INFRA_API reference operator*() const noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator++() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator++(int) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator& operator--() noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const_iterator operator--(int) noexcept;
+            SOFTLOQ_WHATWG_INFRA_API const bool operator==(const const_iterator& b) const noexcept;
+
+            /** @brief Returns the index of the code unit the current code point starts at. */
+            SOFTLOQ_WHATWG_INFRA_API const size_type position() const noexcept;
+            /** @brief Returns the number of code units the current code point occupies (1 or 2). */
+            SOFTLOQ_WHATWG_INFRA_API const size_type width() const noexcept;
+
+        private:
+            const void* units;
+            size_type length;
+            bool wide;
+            size_type pos;
+        };
+        using iterator = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator = const_reverse_iterator;
+
+        SOFTLOQ_WHATWG_INFRA_API code_point_view() noexcept;
+        SOFTLOQ_WHATWG_INFRA_API code_point_view(const void* units, const size_type length, const bool wide) noexcept;
+
+        SOFTLOQ_WHATWG_INFRA_API const_iterator begin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator cbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator end() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator cend() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crbegin() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rend() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crend() const noexcept;
+
+        SOFTLOQ_WHATWG_INFRA_API infra_code_point front() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API infra_code_point back() const noexcept;
+        /** @brief Counts the code points. Constant for one byte units, linear in the number of code units otherwise. */
+        SOFTLOQ_WHATWG_INFRA_API const size_type size() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const bool empty() const noexcept;
+        /** @brief Returns the code point at the specified code point index. Linear in the index. */
+        SOFTLOQ_WHATWG_INFRA_API infra_code_point operator[](const size_type index) const noexcept;
+
+    private:
+        const void* units;
+        size_type length;
+        bool wide;
+    };
+
+    //-----------------//
+
     // common member types //
 
     using tokens_type = infra_list<infra_string>;
 
-    using code_unit_sequence_type = infra_sequence<infra_code_unit>;
-    using code_point_sequence_type = infra_sequence<infra_code_point>;
+    using code_unit_sequence_type = code_unit_view;
+    using code_point_sequence_type = code_point_view;
 
-    using sequence_type = infra_sequence<infra_code_unit>;
     using value_type = infra_code_unit;
-    using size_type = sequence_type::size_type;
+    using size_type = std::size_t;
 
     //-----------------------//
 
     // iterator member types //
 
-    using iterator = sequence_type::iterator;
-    using const_iterator = sequence_type::const_iterator;
-    using reverse_iterator = sequence_type::reverse_iterator;
-    using const_reverse_iterator = sequence_type::const_reverse_iterator;
+    using iterator = code_unit_view::const_iterator;
+    using const_iterator = code_unit_view::const_iterator;
+    using reverse_iterator = code_unit_view::const_reverse_iterator;
+    using const_reverse_iterator = code_unit_view::const_reverse_iterator;
 
     //-----------------------//
 
@@ -56,6 +211,14 @@ public:
      * @brief Constructs a WHATWG infra string with a string.
      * @param values The string whose sequence of characters will be used for the code units of the infra string. */
     SOFTLOQ_WHATWG_INFRA_API infra_string(const std::string& values) noexcept;
+    /** 
+     * @brief Constructs a WHATWG infra string by decoding UTF-8, replacing invalid sequences with U+FFFD. A byte order mark is kept.
+     * @param values The UTF-8 encoded string that will be decoded into the code units of the infra string. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string(const std::u8string& values) noexcept;
+    /** 
+     * @brief Constructs a WHATWG infra string with a copy of the code units of a string view.
+     * @param values The infra string view whose code units will be copied. */
+    SOFTLOQ_WHATWG_INFRA_API explicit infra_string(const infra_string_view& values) noexcept;
     /** 
      * @brief Constructs a WHATWG infra string from another infra string.
      * @param values The infra string that will be copied. */
@@ -75,6 +238,10 @@ public:
      * @brief Assigns the WHATWG infra string with a string.
      * @param values The string whose sequence of characters will be used for the code units of the infra string. */
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator=(const std::string& values) noexcept;
+    /** 
+     * @brief Assigns the WHATWG infra string with a copy of the code units of a string view.
+     * @param values The infra string view whose code units will be copied. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string& operator=(const infra_string_view& values) noexcept;
     /** 
      * @brief Assigns the WHATWG infra string from another infra string.
      * @param values The infra string that will be copied. */
@@ -108,8 +275,8 @@ public:
 
     // WHATWG string member functions //
 
-    SOFTLOQ_WHATWG_INFRA_API const code_unit_sequence_type& code_units() const noexcept;
-    SOFTLOQ_WHATWG_INFRA_API const code_point_sequence_type& code_points() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API code_unit_sequence_type code_units() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API code_point_sequence_type code_points() const noexcept;
 
     SOFTLOQ_WHATWG_INFRA_API std::string code_unit_str() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API std::string code_point_str() const noexcept;
@@ -124,18 +291,34 @@ public:
     SOFTLOQ_WHATWG_INFRA_API const bool is_ascii() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API const bool is_isomorphic() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API const bool is_scalar() const noexcept;
+    /** @brief Checks if the code units are stored two bytes wide. Strings stay one byte wide until a code unit above 0xFF is added. */
+    SOFTLOQ_WHATWG_INFRA_API const bool is_wide() const noexcept;
 
-    
     SOFTLOQ_WHATWG_INFRA_API infra_string code_unit_substr(const size_type start, const size_type length) const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string code_unit_substr(const size_type start) const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string code_point_substr(const size_type start, const size_type length) const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string code_point_substr(const size_type start) const noexcept;
 
     SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence byte_encoding() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API size_type byte_encoding(std::uint8_t* bytes) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API size_type byte_encoding_size() const noexcept;
+    /** @brief UTF-8 decodes bytes (https://encoding.spec.whatwg.org/#utf-8-decode): a leading byte order mark is removed and invalid sequences become U+FFFD. */
+    SOFTLOQ_WHATWG_INFRA_API static infra_string utf8_decode(const infra_byte_sequence& bytes) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API static infra_string utf8_decode(const std::string& bytes) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence isomorphic_encode() const noexcept;
+    /** @brief Isomorphic decodes bytes (https://infra.spec.whatwg.org/#isomorphic-decode): each byte becomes the code point of the same value. */
+    SOFTLOQ_WHATWG_INFRA_API static infra_string isomorphic_decode(const infra_byte_sequence& bytes) noexcept;
+    /** @brief Forgiving-base64 encodes bytes (https://infra.spec.whatwg.org/#forgiving-base64-encode). */
+    SOFTLOQ_WHATWG_INFRA_API static infra_string forgiving_base64_encode(const infra_byte_sequence& data) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_byte_sequence> forgiving_base64_decode() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string ascii_lowercase() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string ascii_uppercase() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void ascii_lowercase_in_place() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void ascii_uppercase_in_place() noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string strip_newlines() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string normalize_newlines() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void strip_newlines_in_place() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void normalize_newlines_in_place() noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string strip_spaces() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string collapse_spaces() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string collect(const std::function<const bool (const infra_code_point)>& cond) const noexcept;
@@ -143,26 +326,27 @@ public:
     SOFTLOQ_WHATWG_INFRA_API tokens_type split(const infra_code_point& delim) const noexcept;
     SOFTLOQ_WHATWG_INFRA_API tokens_type split_spaces() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API tokens_type split_commas() const noexcept;
-    SOFTLOQ_WHATWG_INFRA_API static infra_string concatenate(const infra_list<infra_string>& list, infra_string separator = {}) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API static infra_string concatenate(const infra_list<infra_string>& list) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API static infra_string concatenate(const infra_list<infra_string>& list, const infra_string_view& separator) noexcept;
 
     //--------------------------------//
 
     // WHATWG sequence member functions //
     
-    SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& front_code_unit() const noexcept;
-    SOFTLOQ_WHATWG_INFRA_API const infra_code_point& front_code_point() const noexcept;
-    SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& back_code_unit() const noexcept;
-    SOFTLOQ_WHATWG_INFRA_API const infra_code_point& back_code_point() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit front_code_unit() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_point front_code_point() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit back_code_unit() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_point back_code_point() const noexcept;
 
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(const std::string& values) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(const infra_string& values) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(const infra_string_view& values) noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(const infra_code_unit& unit) noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(infra_code_unit&& unit) noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(const infra_code_point& point) noexcept;
     SOFTLOQ_WHATWG_INFRA_API infra_string& operator+=(infra_code_point&& point) noexcept;
     
     SOFTLOQ_WHATWG_INFRA_API void push_back(const std::string& values) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API void push_back(const infra_string& values) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void push_back(const infra_string_view& values) noexcept;
     SOFTLOQ_WHATWG_INFRA_API void push_back(const infra_code_unit& unit) noexcept;
     SOFTLOQ_WHATWG_INFRA_API void push_back(infra_code_unit&& unit) noexcept;
     SOFTLOQ_WHATWG_INFRA_API void push_back(const infra_code_point& point) noexcept;
@@ -173,8 +357,9 @@ public:
 
     SOFTLOQ_WHATWG_INFRA_API const bool empty() const noexcept;
     SOFTLOQ_WHATWG_INFRA_API void clear() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void reserve(const size_type new_capacity) noexcept;
 
-    SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& operator[](const code_unit_sequence_type::size_type index) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit operator[](const code_unit_sequence_type::size_type index) const noexcept;
     
     //----------------------------------//
 
@@ -193,17 +378,43 @@ public:
 
     //------------------------------------//
 
+    /** @brief Number of bytes stored inline before the string allocates: 32 one byte code units or 16 two byte code units. */
+    static constexpr size_type local_capacity_bytes = 32;
+
 private:
-    infra_sequence<infra_code_point> points;
-    infra_sequence<infra_code_unit> units;
+    friend class infra_base64_encoder;
+
+    // code units, one byte each while every unit is <= 0xFF, two bytes each once wide
+    union
+    {
+        struct
+        {
+            void* data;
+            size_type capacity_bytes;
+        } heap;
+        alignas(std::uint16_t) std::uint8_t local[local_capacity_bytes];
+    } storage;
+    size_type length;
+    bool wide;
+    bool is_local;
 
     // auxiliary member functions //
 
     SOFTLOQ_WHATWG_INFRA_API void push_code_unit(const infra_code_unit& unit) noexcept;
     SOFTLOQ_WHATWG_INFRA_API void push_code_unit(const infra_code_point& point) noexcept;
 
-    SOFTLOQ_WHATWG_INFRA_API void push_code_point(const infra_code_unit& unit) noexcept;
-    SOFTLOQ_WHATWG_INFRA_API void push_code_point(const infra_code_point& point) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void append_units(const std::uint8_t* units, const size_type count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void append_units(const std::uint16_t* units, const size_type count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void grow(const size_type count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void widen() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void narrow() noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void decode_utf8(const std::uint8_t* bytes, const size_type count) noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool overlaps(const infra_string_view& values) const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API void* buffer() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const size_type capacity_bytes() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::uint8_t* latin1_data() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::uint16_t* utf16_data() const noexcept;
 
     //----------------------------//
 };
@@ -211,20 +422,13 @@ private:
 // auxiliary functions //
 
 SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const std::string& b) noexcept;
-SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_string& b) noexcept;
+SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_string_view& b) noexcept;
 SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_code_unit& b) noexcept;
 SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_code_point& b) noexcept;
 
 //---------------------//
-
-// WHATWG string comparison functions //
-
-SOFTLOQ_WHATWG_INFRA_API const bool is_prefix(const infra_string& a, const infra_string& b) noexcept;
-SOFTLOQ_WHATWG_INFRA_API const bool is_suffix(const infra_string& a, const infra_string& b) noexcept;
-SOFTLOQ_WHATWG_INFRA_API const bool is_code_unit_less_than(const infra_string& a, const infra_string& b) noexcept;
-SOFTLOQ_WHATWG_INFRA_API const bool is_ascii_iequal(const infra_string& a, const infra_string& b) noexcept;
-
-//------------------------------------//
 }
 
+#include "softloq/whatwg/infra/primitive/string_view.hpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,262 @@
+/**
+ * @file string_view.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra string view class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_VIEW_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_STRING_VIEW_HPP
+
+#include "softloq/whatwg/infra/primitive/string.hpp"
+
+#include <optional>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Non-owning, read-only view over the code units of a WHATWG infra string (https://infra.spec.whatwg.org/#strings).
+ * Substrings and stripped results are views into the same code units, so the viewed string must outlive the view. */
+class infra_string_view final
+{
+public:
+    // token view //
+
+    class token_view;
+
+    //------------//
+
+    // common member types //
+
+    using tokens_type = token_view;
+
+    using code_unit_sequence_type = infra_string::code_unit_view;
+    using code_point_sequence_type = infra_string::code_point_view;
+
+    using value_type = infra_code_unit;
+    using size_type = std::size_t;
+
+    //-----------------------//
+
+    // iterator member types //
+
+    using iterator = code_unit_sequence_type::const_iterator;
+    using const_iterator = code_unit_sequence_type::const_iterator;
+    using reverse_iterator = code_unit_sequence_type::const_reverse_iterator;
+    using const_reverse_iterator = code_unit_sequence_type::const_reverse_iterator;
+
+    //-----------------------//
+
+    // constructors //
+
+    /** @brief Constructs an empty WHATWG infra string view. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view() noexcept;
+    /**
+     * @brief Constructs a WHATWG infra string view over all the code units of a string.
+     * @param string The infra string that will be viewed. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view(const infra_string& string) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra string view over a sequence of code units.
+     * @param units The code units that will be viewed. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view(const code_unit_sequence_type& units) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra string view over one byte (Latin-1) code units.
+     * @param units The first code unit.
+     * @param length The number of code units. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view(const std::uint8_t* units, const size_type length) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra string view over two byte (UTF-16) code units.
+     * @param units The first code unit.
+     * @param length The number of code units. */
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view(const std::uint16_t* units, const size_type length) noexcept;
+    infra_string_view(const infra_string_view& src) noexcept = default;
+    infra_string_view& operator=(const infra_string_view& src) noexcept = default;
+
+    //--------------//
+
+    // iterator member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API const_iterator begin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator cbegin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator end() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator cend() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rbegin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crbegin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator rend() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_reverse_iterator crend() const noexcept;
+
+    //---------------------------//
+
+    // WHATWG string member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API code_unit_sequence_type code_units() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API code_point_sequence_type code_points() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API std::string code_unit_str() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::string code_point_str() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API std::string quoted_str() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API size_type size() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API code_unit_sequence_type::size_type code_unit_size() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API code_point_sequence_type::size_type code_point_size() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API const bool is_ascii() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_isomorphic() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool is_scalar() const noexcept;
+    /** @brief Checks if the viewed code units are stored two bytes wide. */
+    SOFTLOQ_WHATWG_INFRA_API const bool is_wide() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view code_unit_substr(const size_type start, const size_type length) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view code_unit_substr(const size_type start) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view code_point_substr(const size_type start, const size_type length) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view code_point_substr(const size_type start) const noexcept;
+
+    /** @brief UTF-8 encodes the viewed code units (https://encoding.spec.whatwg.org/#utf-8-encode), with each lone surrogate encoded as U+FFFD. */
+    SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence byte_encoding() const noexcept;
+    /**
+     * @brief UTF-8 encodes the viewed code units into a caller buffer.
+     * @param bytes The buffer, with room for at least byte_encoding_size() bytes.
+     * @return The number of bytes written. */
+    SOFTLOQ_WHATWG_INFRA_API size_type byte_encoding(std::uint8_t* bytes) const noexcept;
+    /** @brief Counts the bytes the UTF-8 encoding of the viewed code units takes. */
+    SOFTLOQ_WHATWG_INFRA_API size_type byte_encoding_size() const noexcept;
+    /**
+     * @brief Isomorphic encodes the viewed code units (https://infra.spec.whatwg.org/#isomorphic-encode): each code unit becomes the byte of the same value.
+     * The view should be isomorphic; only the low byte of a code unit above 0xFF is kept. */
+    SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence isomorphic_encode() const noexcept;
+    /**
+     * @brief Forgiving-base64 decodes the viewed code units (https://infra.spec.whatwg.org/#forgiving-base64-decode), skipping ASCII whitespace.
+     * @return The decoded bytes, or std::nullopt if the code units are not valid base64. */
+    SOFTLOQ_WHATWG_INFRA_API std::optional<infra_byte_sequence> forgiving_base64_decode() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_string_view strip_spaces() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API void skip_spaces(code_point_sequence_type::size_type& point_pos) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API tokens_type split(const infra_code_point& delim) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API tokens_type split_spaces() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API tokens_type split_commas() const noexcept;
+
+    //--------------------------------//
+
+    // WHATWG sequence member functions //
+
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit front_code_unit() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_point front_code_point() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit back_code_unit() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API infra_code_point back_code_point() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API const bool empty() const noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API infra_code_unit operator[](const code_unit_sequence_type::size_type index) const noexcept;
+
+    //----------------------------------//
+
+    // WHATWG primitive functions //
+
+    SOFTLOQ_WHATWG_INFRA_API void print(std::ostream& out) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API friend std::ostream& operator<<(std::ostream& out, const infra_string_view& view) noexcept;
+
+    //----------------------------//
+
+    // WHATWG string comparison functions //
+
+    SOFTLOQ_WHATWG_INFRA_API const bool operator<(const infra_string_view& b) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool operator>(const infra_string_view& b) const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool operator==(const infra_string_view& b) const noexcept;
+    /** @brief Hashes the code units. Views that compare equal hash alike, whether their code units are stored one or two bytes wide. */
+    SOFTLOQ_WHATWG_INFRA_API const std::size_t hash() const noexcept;
+
+    //------------------------------------//
+
+private:
+    friend class infra_base64_decoder;
+
+    const void* units;
+    size_type length;
+    bool wide;
+};
+
+// token view //
+
+/**
+ * @brief Lazy range over the tokens of a string view. Each token is a view into the source, found one at a time while iterating,
+ * so splitting makes a single pass over the code units and allocates nothing. */
+class infra_string_view::token_view
+{
+public:
+    /** @brief How the source is split: on a code point, on runs of U+0020 SPACE, or on U+002C (,) with the tokens stripped of spaces. */
+    enum class split_type { code_point, spaces, commas };
+
+    using value_type = infra_string_view;
+    using size_type = std::size_t;
+
+    /** @brief Forward iterator that yields the tokens by value. It copies the source view, so it stays valid after the token view is gone. */
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = infra_string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = infra_string_view;
+
+        SOFTLOQ_WHATWG_INFRA_API const_iterator() noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator(const token_view& tokens, const size_type pos) noexcept;
+
+        SOFTLOQ_WHATWG_INFRA_API reference operator*() const noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator& operator++() noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const_iterator operator++(int) noexcept;
+        SOFTLOQ_WHATWG_INFRA_API const bool operator==(const const_iterator& b) const noexcept;
+
+    private:
+        infra_string_view source;
+        split_type type;
+        infra_code_point delim;
+        size_type pos;
+        size_type token_end;
+        size_type next;
+
+        SOFTLOQ_WHATWG_INFRA_API void find_token() noexcept;
+    };
+    using iterator = const_iterator;
+
+    SOFTLOQ_WHATWG_INFRA_API token_view(const infra_string_view& source, const split_type type, const infra_code_point& delim) noexcept;
+
+    SOFTLOQ_WHATWG_INFRA_API const_iterator begin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator cbegin() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator end() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const_iterator cend() const noexcept;
+
+    /** @brief Counts the tokens. Linear in the number of code units. */
+    SOFTLOQ_WHATWG_INFRA_API const size_type size() const noexcept;
+    SOFTLOQ_WHATWG_INFRA_API const bool empty() const noexcept;
+
+private:
+    infra_string_view source;
+    split_type type;
+    infra_code_point delim;
+};
+
+//------------//
+
+// WHATWG string comparison functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool is_prefix(const infra_string_view& a, const infra_string_view& b) noexcept;
+SOFTLOQ_WHATWG_INFRA_API const bool is_suffix(const infra_string_view& a, const infra_string_view& b) noexcept;
+SOFTLOQ_WHATWG_INFRA_API const bool is_code_unit_less_than(const infra_string_view& a, const infra_string_view& b) noexcept;
+SOFTLOQ_WHATWG_INFRA_API const bool is_ascii_iequal(const infra_string_view& a, const infra_string_view& b) noexcept;
+
+//------------------------------------//
+}
+
+// standard library hashes //
+
+template <> struct std::hash<softloq::whatwg::infra_string_view>
+{
+    std::size_t operator()(const softloq::whatwg::infra_string_view& value) const noexcept { return value.hash(); }
+};
+template <> struct std::hash<softloq::whatwg::infra_string>
+{
+    std::size_t operator()(const softloq::whatwg::infra_string& value) const noexcept { return softloq::whatwg::infra_string_view{value}.hash(); }
+};
+
+//-------------------------//
+
+#endif
\ No newline at end of file
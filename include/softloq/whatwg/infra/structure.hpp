@@ -7,10 +7,14 @@
 #ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_HPP
 #define SOFTLOQ_WHATWG_INFRA_STRUCTURE_HPP
 
+#include "softloq/whatwg/infra/structure/lock.hpp"
 #include "softloq/whatwg/infra/structure/sequence.hpp"
 #include "softloq/whatwg/infra/structure/list.hpp"
 #include "softloq/whatwg/infra/structure/stack.hpp"
+#include "softloq/whatwg/infra/structure/lockfree_stack.hpp"
 #include "softloq/whatwg/infra/structure/queue.hpp"
+#include "softloq/whatwg/infra/structure/mpmc_queue.hpp"
+#include "softloq/whatwg/infra/structure/spsc_queue.hpp"
 #include "softloq/whatwg/infra/structure/set.hpp"
 
 #endif
\ No newline at end of file
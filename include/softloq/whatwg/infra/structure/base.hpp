@@ -14,7 +14,7 @@
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra data structure types */
-enum class infra_structure_type { infra_sequence, infra_list, infra_map, infra_struct };
+enum class infra_structure_type { infra_sequence, infra_list, infra_ordered_set, infra_map, infra_struct };
 
 /** @brief WHATWG infra data structure base class. Abstract C++ class. */
 class infra_structure_base
@@ -8,24 +8,33 @@
 #define SOFTLOQ_WHATWG_INFRA_STRUCTURE_LIST_HPP
 
 #include "softloq/whatwg/infra/structure/base.hpp"
+#include "softloq/whatwg/infra/structure/lock.hpp"
 
 #include <initializer_list>
 #include <functional>
+#include <deque>
 #include <list>
-#include <mutex>
 
 namespace softloq::whatwg
 {
-/** @brief WHATWG infra sequence data structure template class (https://infra.spec.whatwg.org/#lists). Internal container access and iterator functions are thread-safe. */
-template <class T> class infra_list : public infra_structure_base
+/**
+ * @brief WHATWG infra sequence data structure template class (https://infra.spec.whatwg.org/#lists). Internal container access and iterator functions are thread-safe
+ * under the locking policy, which is infra_mutex_lock by default; infra_no_lock leaves synchronizing to the user.
+ * Items are kept in blocks of a std::deque by default, so iterating walks contiguous memory. Every change to a deque backed list invalidates its
+ * iterators: appending and prepending keep references to the other items valid, while insert and remove in the middle invalidate those too and move
+ * the items between the position and the nearer end, which costs O(min(index, size - index)). Code that holds iterators across changes should use
+ * infra_node_list, whose std::list container keeps iterators and references valid through every change but to the removed item, and inserts in
+ * constant time once the position is reached. A std::vector container keeps all of the items in one block. */
+template <class T, class Container = std::deque<T>, class Lock = infra_mutex_lock> class infra_list : public infra_structure_base
 {
 public:
     
     // common member types //
 
-    using container_type = std::list<T>;
+    using container_type = Container;
     using value_type = T;
     using size_type	= std::size_t;
+    using lock_type = Lock;
 
     //---------------------//
 
@@ -93,35 +102,39 @@ public:
 
     // WHATWG list member functions //
 
-    virtual T& front() noexcept;
-    virtual const T& front() const noexcept;
-    virtual T& back() noexcept;
-    virtual const T& back() const noexcept;
+    T& front() noexcept;
+    const T& front() const noexcept;
+    T& back() noexcept;
+    const T& back() const noexcept;
 
-    virtual void append(const T& item) noexcept;
-    virtual void append(T&& item) noexcept;
-    virtual void pop_back() noexcept;
+    void append(const T& item) noexcept;
+    void append(T&& item) noexcept;
+    void pop_back() noexcept;
 
-    virtual void prepend(const T& item) noexcept;
-    virtual void prepend(T&& item) noexcept;
-    virtual void pop_front() noexcept;
+    void prepend(const T& item) noexcept;
+    void prepend(T&& item) noexcept;
+    void pop_front() noexcept;
 
-    virtual void extend(const infra_list& list) noexcept;
-    virtual void extend(infra_list&& list) noexcept;
+    void extend(const infra_list& list) noexcept;
+    void extend(infra_list&& list) noexcept;
 
-    virtual void replace(const T& item, const std::function<const bool (const T& item)>& cond) noexcept;
+    void replace(const T& item, const std::function<const bool (const T& item)>& cond) noexcept;
 
-    virtual void insert(const size_type index, const T& item) noexcept;
-    virtual void insert(const size_type index, T&& item) noexcept;
+    void insert(const size_type index, const T& item) noexcept;
+    void insert(const size_type index, T&& item) noexcept;
 
-    virtual void remove(const T& item) noexcept;
-    virtual void remove_if(const std::function<const bool (const T& item)>& cond) noexcept;
+    void remove(const T& item) noexcept;
+    void remove_if(const std::function<const bool (const T& item)>& cond) noexcept;
     
     const size_type size() const noexcept;
     const bool empty() const noexcept;
-    virtual void clear() noexcept;
+    void clear() noexcept;
 
-    virtual const bool contains(const T& item) const noexcept;
+    const bool contains(const T& item) const noexcept;
+    /**
+     * @brief Performs the steps on each item in order (https://infra.spec.whatwg.org/#list-iterate), holding the read lock for the whole walk
+     * instead of only while an iterator is taken. Under infra_shared_mutex_lock, readers iterate at the same time. The steps must not change the list. */
+    void for_each(const std::function<void (const T& item)>& steps) const noexcept;
     infra_list clone() const noexcept;
 
     void sort_ascending() noexcept;
@@ -137,13 +150,24 @@ public:
     //---------------------------------//
 
 protected:
-    mutable std::mutex mtx;
-    std::list<T> data;
+    using write_lock = Lock::write_lock;
+    using read_lock = Lock::read_lock;
+
+    [[no_unique_address]] mutable Lock::mutex_type mtx;
+    Container data;
 
 private:
-    infra_list(const infra_list& src, const std::lock_guard<std::mutex>&) noexcept;
-    infra_list(infra_list&& src, const std::lock_guard<std::mutex>&) noexcept;
+    /** @brief Sorts stably, as WHATWG list sorting is, with the caller holding the lock. */
+    template <class Compare> void sort(const Compare& comp) noexcept;
+
+    infra_list(const infra_list& src, const read_lock&) noexcept;
+    infra_list(infra_list&& src, const write_lock&) noexcept;
 };
+
+/** @brief WHATWG infra list whose items each live in their own node, for when iterators have to stay valid while the list changes. */
+template <class T, class Lock = infra_mutex_lock> using infra_node_list = infra_list<T, std::list<T>, Lock>;
+/** @brief WHATWG infra list for data that many threads read and few change: const member functions, such as contains, size and for_each, share the lock. */
+template <class T> using infra_shared_list = infra_list<T, std::deque<T>, infra_shared_mutex_lock>;
 }
 
 #include "softloq/whatwg/infra/structure/list.tpp"
@@ -13,30 +13,30 @@ namespace softloq::whatwg
 {
 // constructors //
 
-template <class T> infra_list<T>::infra_list() noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list() noexcept
 {
 }
-template <class T> infra_list<T>::infra_list(const std::initializer_list<T>& values) noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list(const std::initializer_list<T>& values) noexcept
 : data(values)
 {
 }
-template <class T> infra_list<T>::infra_list(const infra_list& src) noexcept
-: infra_list(src, std::lock_guard<std::mutex>(src.mtx))
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list(const infra_list& src) noexcept
+: infra_list(src, read_lock(src.mtx))
 {
 }
-template <class T> infra_list<T>::infra_list(infra_list&& src) noexcept
-: infra_list(std::move(src), std::lock_guard<std::mutex>(src.mtx))
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list(infra_list&& src) noexcept
+: infra_list(std::move(src), write_lock(src.mtx))
 {
 }
-template <class T> infra_list<T>::infra_list(const infra_list& src, const std::lock_guard<std::mutex>&) noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list(const infra_list& src, const read_lock&) noexcept
 : data(src.data)
 {
 }
-template <class T> infra_list<T>::infra_list(infra_list&& src, const std::lock_guard<std::mutex>&) noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::infra_list(infra_list&& src, const write_lock&) noexcept
 : data(std::move(src.data))
 {
 }
-template <class T> infra_list<T>::~infra_list() noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::~infra_list() noexcept
 {
 }
 
@@ -44,17 +44,17 @@ template <class T> infra_list<T>::~infra_list() noexcept
 
 // assignments //
 
-template <class T> infra_list<T>& infra_list<T>::operator=(const infra_list& src) noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>& infra_list<T, Container, Lock>::operator=(const infra_list& src) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> src_lock(src.mtx);
+    write_lock lock(mtx);
+    read_lock src_lock(src.mtx);
     data = src.data;
     return *this;
 }
-template <class T> infra_list<T>& infra_list<T>::operator=(infra_list&& src) noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>& infra_list<T, Container, Lock>::operator=(infra_list&& src) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> src_lock(src.mtx);
+    write_lock lock(mtx);
+    write_lock src_lock(src.mtx);
     data = std::move(src.data);
     return *this;
 }
@@ -63,67 +63,67 @@ template <class T> infra_list<T>& infra_list<T>::operator=(infra_list&& src) noe
 
 // iterator member functions //
 
-template <class T> infra_list<T>::iterator infra_list<T>::begin()
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::iterator infra_list<T, Container, Lock>::begin()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.begin();
 }
-template <class T> infra_list<T>::const_iterator infra_list<T>::begin() const
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_iterator infra_list<T, Container, Lock>::begin() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.begin();
 }
-template <class T> infra_list<T>::const_iterator infra_list<T>::cbegin() const noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_iterator infra_list<T, Container, Lock>::cbegin() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.cbegin();
 }
 
-template <class T> infra_list<T>::iterator infra_list<T>::end()
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::iterator infra_list<T, Container, Lock>::end()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.end();
 }
-template <class T> infra_list<T>::const_iterator infra_list<T>::end() const
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_iterator infra_list<T, Container, Lock>::end() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.end();
 }
-template <class T> infra_list<T>::const_iterator infra_list<T>::cend() const noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_iterator infra_list<T, Container, Lock>::cend() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.cend();
 }
 
-template <class T> infra_list<T>::reverse_iterator infra_list<T>::rbegin()
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::reverse_iterator infra_list<T, Container, Lock>::rbegin()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.rbegin();
 }
-template <class T> infra_list<T>::const_reverse_iterator infra_list<T>::rbegin() const
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_reverse_iterator infra_list<T, Container, Lock>::rbegin() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.rbegin();
 }
-template <class T> infra_list<T>::const_reverse_iterator infra_list<T>::crbegin() const noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_reverse_iterator infra_list<T, Container, Lock>::crbegin() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.crbegin();
 }
 
-template <class T> infra_list<T>::reverse_iterator infra_list<T>::rend()
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::reverse_iterator infra_list<T, Container, Lock>::rend()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.rend();
 }
-template <class T> infra_list<T>::const_reverse_iterator infra_list<T>::rend() const
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_reverse_iterator infra_list<T, Container, Lock>::rend() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.rend();
 }
-template <class T> infra_list<T>::const_reverse_iterator infra_list<T>::crend() const noexcept
+template <class T, class Container, class Lock> infra_list<T, Container, Lock>::const_reverse_iterator infra_list<T, Container, Lock>::crend() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.crend();
 }
 
@@ -131,148 +131,164 @@ template <class T> infra_list<T>::const_reverse_iterator infra_list<T>::crend()
 
 // WHATWG list member functions //
 
-template <class T> T& infra_list<T>::front() noexcept
+template <class T, class Container, class Lock> T& infra_list<T, Container, Lock>::front() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.front();
 }
-template <class T> const T& infra_list<T>::front() const noexcept
+template <class T, class Container, class Lock> const T& infra_list<T, Container, Lock>::front() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.front();
 }
-template <class T> T& infra_list<T>::back() noexcept
+template <class T, class Container, class Lock> T& infra_list<T, Container, Lock>::back() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.back();
 }
-template <class T> const T& infra_list<T>::back() const noexcept
+template <class T, class Container, class Lock> const T& infra_list<T, Container, Lock>::back() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.back();
 }
 
-template <class T> void infra_list<T>::append(const T& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::append(const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(item);
 }
-template <class T> void infra_list<T>::append(T&& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::append(T&& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(std::move(item));
 }
-template <class T> void infra_list<T>::pop_back() noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::pop_back() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.pop_back();
 }
 
-template <class T> void infra_list<T>::prepend(const T& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::prepend(const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.push_front(item);
+    write_lock lock(mtx);
+    data.insert(data.cbegin(), item);
 }
-template <class T> void infra_list<T>::prepend(T&& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::prepend(T&& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.push_front(std::move(item));
+    write_lock lock(mtx);
+    data.insert(data.cbegin(), std::move(item));
 }
-template <class T> void infra_list<T>::pop_front() noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::pop_front() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.pop_front();
+    write_lock lock(mtx);
+    data.erase(data.cbegin());
 }
 
-template <class T> void infra_list<T>::extend(const infra_list& list) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::extend(const infra_list& list) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> list_lock(list.mtx);
-    data.insert_range(data.cend(), list.data);
+    write_lock lock(mtx);
+    read_lock list_lock(list.mtx);
+    data.insert(data.cend(), list.data.cbegin(), list.data.cend());
 }
-template <class T> void infra_list<T>::extend(infra_list&& list) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::extend(infra_list&& list) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> list_lock(list.mtx);
-    data.insert_range(data.cend(), std::move(list.data));
+    write_lock lock(mtx);
+    write_lock list_lock(list.mtx);
+    data.insert(data.cend(), std::make_move_iterator(list.data.begin()), std::make_move_iterator(list.data.end()));
 }
 
-template <class T> void infra_list<T>::replace(const T& item, const std::function<const bool (const T& item)>& cond) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::replace(const T& item, const std::function<const bool (const T& item)>& cond) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     std::transform(data.cbegin(), data.cend(), data.begin(), [&](auto& x) { return cond(x) ? item : x; });
 }
 
-template <class T> void infra_list<T>::insert(const size_type index, const T& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::insert(const size_type index, const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.insert(std::next(data.cbegin(), index), item);
 }
-template <class T> void infra_list<T>::insert(const size_type index, T&& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::insert(const size_type index, T&& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.insert(std::next(data.cbegin(), index), std::move(item));
 }
 
-template <class T> void infra_list<T>::remove(const T& item) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::remove(const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.remove(item);
+    write_lock lock(mtx);
+    std::erase(data, item);
 }
-template <class T> void infra_list<T>::remove_if(const std::function<const bool (const T& item)>& cond) noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::remove_if(const std::function<const bool (const T& item)>& cond) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.remove_if(cond);
+    write_lock lock(mtx);
+    std::erase_if(data, cond);
 }
 
-template <class T> const infra_list<T>::size_type infra_list<T>::size() const noexcept
+template <class T, class Container, class Lock> const infra_list<T, Container, Lock>::size_type infra_list<T, Container, Lock>::size() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.size();
 }
-template <class T> const bool infra_list<T>::empty() const noexcept
+template <class T, class Container, class Lock> const bool infra_list<T, Container, Lock>::empty() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.empty();
 }
-template <class T> void infra_list<T>::clear() noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::clear() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.clear();
 }
 
-template <class T> const bool infra_list<T>::contains(const T& item) const noexcept
+template <class T, class Container, class Lock> const bool infra_list<T, Container, Lock>::contains(const T& item) const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     for (const auto& x: data) if (item == x) return true;
     return false;
 }
-template <class T> infra_list<T> infra_list<T>::clone() const noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::for_each(const std::function<void (const T& item)>& steps) const noexcept
+{
+    read_lock lock(mtx);
+    for (const auto& x: data) steps(x);
+}
+template <class T, class Container, class Lock> infra_list<T, Container, Lock> infra_list<T, Container, Lock>::clone() const noexcept
 {
     return *this;
 }
-template <class T> void infra_list<T>::sort_ascending() noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::sort_ascending() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.sort(std::less<T>());
+    write_lock lock(mtx);
+    sort(std::less<T>());
 }
-template <class T> void infra_list<T>::sort_descending() noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::sort_descending() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    data.sort(std::greater<T>());
+    write_lock lock(mtx);
+    sort(std::greater<T>());
 }
 
 //------------------------------//
 
+// sorting //
+
+template <class T, class Container, class Lock> template <class Compare> void infra_list<T, Container, Lock>::sort(const Compare& comp) noexcept
+{
+    // a node list relinks its nodes instead of moving the items
+    if constexpr (requires { data.sort(comp); }) data.sort(comp);
+    else std::stable_sort(data.begin(), data.end(), comp);
+}
+
+//---------//
+
 // WHATWG structure base overrides //
 
-template <class T> const infra_structure_type infra_list<T>::structure_type() const noexcept
+template <class T, class Container, class Lock> const infra_structure_type infra_list<T, Container, Lock>::structure_type() const noexcept
 {
     return infra_structure_type::infra_list;
 }
-template <class T> void infra_list<T>::print(std::ostream& out) const noexcept
+template <class T, class Container, class Lock> void infra_list<T, Container, Lock>::print(std::ostream& out) const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     auto curr_it = data.cbegin();
     auto last_it = data.cend();
     out << "« ";
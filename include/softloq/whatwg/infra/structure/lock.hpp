@@ -0,0 +1,54 @@
+/**
+ * @file lock.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the locking policies of the WHATWG infra data structure classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_LOCK_HPP
+#define SOFTLOQ_WHATWG_INFRA_STRUCTURE_LOCK_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Bytes kept between data that different threads write, so that they do not share a cache line. A fixed value instead of
+ * std::hardware_destructive_interference_size, which may change with compiler flags and so is not safe in an interface. */
+inline constexpr std::size_t infra_cache_line_size = 64;
+
+/**
+ * @brief Locking policy that takes no lock. For structures that are only used by one thread at a time, or that are guarded by a lock of
+ * their owner, where locking on every access would only cost an atomic read-modify-write each time. */
+struct infra_no_lock
+{
+    /** @brief A mutex whose locking does nothing. */
+    struct mutex_type
+    {
+        constexpr void lock() noexcept {}
+        constexpr bool try_lock() noexcept { return true; }
+        constexpr void unlock() noexcept {}
+    };
+    using write_lock = std::lock_guard<mutex_type>;
+    using read_lock = std::lock_guard<mutex_type>;
+};
+
+/** @brief Locking policy that takes a std::mutex for every access, so that readers wait on each other as well as on writers. */
+struct infra_mutex_lock
+{
+    using mutex_type = std::mutex;
+    using write_lock = std::lock_guard<std::mutex>;
+    using read_lock = std::lock_guard<std::mutex>;
+};
+
+/** @brief Locking policy that takes a std::shared_mutex, exclusively for changes and shared for const access, so that readers run together. */
+struct infra_shared_mutex_lock
+{
+    using mutex_type = std::shared_mutex;
+    using write_lock = std::lock_guard<std::shared_mutex>;
+    using read_lock = std::shared_lock<std::shared_mutex>;
+};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file lockfree_stack.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra lock-free stack class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_LOCKFREE_STACK_HPP
+#define SOFTLOQ_WHATWG_INFRA_STRUCTURE_LOCKFREE_STACK_HPP
+
+#include "softloq/whatwg/infra/structure/lock.hpp"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Unbounded lock-free stack (https://infra.spec.whatwg.org/#stacks) for any number of threads, with the push, pop and peek of infra_stack.
+ * Items live in nodes linked from an atomic top, which push and pop swing with one compare-and-swap (a Treiber stack). When that
+ * compare-and-swap loses to another thread, push offers its node in an elimination array and pop looks there for one, so that a push
+ * and a pop that collide pass the item between them without touching the top at all.
+ *
+ * Popped nodes are freed with hazard pointers: a thread publishes the node it is about to read, and a retired node is only freed once no
+ * thread publishes it. Since a node cannot be freed and allocated again while a thread still holds it, the top can never return to a node
+ * a thread read earlier, which also rules out the ABA problem of the compare-and-swap without tagged pointers.
+ * Unlike infra_stack it is not a list: it has no iteration, size or list operations. */
+template <class T> class infra_lockfree_stack final
+{
+public:
+    // common member types //
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //---------------------//
+
+    // constructors //
+
+    /** @brief Constructs an empty WHATWG infra lock-free stack. */
+    infra_lockfree_stack() noexcept;
+    infra_lockfree_stack(const infra_lockfree_stack& src) = delete;
+    /** @brief Destroys the items left in the stack. No other thread may use the stack any more. */
+    ~infra_lockfree_stack() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_lockfree_stack& operator=(const infra_lockfree_stack& src) = delete;
+
+    //-------------//
+
+    // WHATWG stack member functions //
+
+    /** @brief Returns a copy of the item at the top of the stack without removing it, or std::nullopt if the stack is empty. */
+    std::optional<T> peek() const noexcept requires std::is_copy_constructible_v<T>;
+    /** @brief Adds the item to the top of the stack. */
+    void push(const T& item) noexcept;
+    void push(T&& item) noexcept;
+    /**
+     * @brief Removes the item at the top of the stack and returns it, or returns std::nullopt if the stack is empty.
+     * Another thread may be copying the same item in peek, so an item that can be copied is copied out rather than moved. */
+    std::optional<T> pop() noexcept;
+
+    /** @brief Checks if the stack is empty, which is only a snapshot while other threads use it. */
+    const bool empty() const noexcept;
+
+    //-------------------------------//
+
+private:
+    struct node
+    {
+        T value;
+        node* next;
+        node* retired_next;
+    };
+    struct alignas(infra_cache_line_size) hazard_record
+    {
+        std::atomic<bool> active{false};
+        std::atomic<node*> pointer{nullptr};
+        hazard_record* next_extra{nullptr};
+    };
+    /** @brief Holds a hazard record of the stack for the length of one call. */
+    class hazard_scope
+    {
+    public:
+        explicit hazard_scope(const infra_lockfree_stack& stack) noexcept;
+        ~hazard_scope() noexcept;
+        hazard_record& record;
+    };
+    struct alignas(infra_cache_line_size) exchanger
+    {
+        std::atomic<node*> offer{nullptr};
+    };
+
+    static constexpr size_type elimination_size = 8;
+    static constexpr size_type elimination_spins = 64;
+    // an offer in the elimination array becomes this once a pop takes it; it is only compared against, never read through
+    static inline char taken_marker;
+
+    const size_type record_mask;
+    const std::unique_ptr<hazard_record[]> records;
+    mutable std::atomic<hazard_record*> extra_records;
+    alignas(infra_cache_line_size) std::atomic<node*> top;
+    alignas(infra_cache_line_size) std::atomic<node*> retired;
+    std::atomic<size_type> retired_count;
+    std::array<exchanger, elimination_size> exchangers;
+
+    static node* taken() noexcept;
+    static const size_type thread_hint() noexcept;
+
+    hazard_record& acquire_record() const noexcept;
+    node* protect(hazard_record& record) const noexcept;
+    void push_node(node* const pushed) noexcept;
+    const bool offer(node* const pushed) noexcept;
+    node* take() noexcept;
+    void retire(node* const popped) noexcept;
+    void reclaim() noexcept;
+};
+}
+
+#include "softloq/whatwg/infra/structure/lockfree_stack.tpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,225 @@
+/**
+ * @file lockfree_stack.tpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Template implementation of the WHATWG infra lock-free stack class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/structure/lockfree_stack.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace softloq::whatwg
+{
+// constructors //
+
+template <class T> infra_lockfree_stack<T>::infra_lockfree_stack() noexcept
+: record_mask{std::bit_ceil(std::max<size_type>(16, 2 * std::thread::hardware_concurrency())) - 1}, records{std::make_unique<hazard_record[]>(record_mask + 1)},
+  extra_records{nullptr}, top{nullptr}, retired{nullptr}, retired_count{0}
+{
+}
+template <class T> infra_lockfree_stack<T>::~infra_lockfree_stack() noexcept
+{
+    for (node* item = top.load(std::memory_order_acquire); item;) delete std::exchange(item, item->next);
+    for (node* item = retired.load(std::memory_order_acquire); item;) delete std::exchange(item, item->retired_next);
+    for (hazard_record* record = extra_records.load(std::memory_order_acquire); record;) delete std::exchange(record, record->next_extra);
+}
+
+//--------------//
+
+// WHATWG stack member functions //
+
+template <class T> std::optional<T> infra_lockfree_stack<T>::peek() const noexcept requires std::is_copy_constructible_v<T>
+{
+    const hazard_scope hazard{*this};
+    const node* const head = protect(hazard.record);
+    return head ? std::optional<T>{head->value} : std::optional<T>{};
+}
+template <class T> void infra_lockfree_stack<T>::push(const T& item) noexcept
+{
+    push_node(new node{item, nullptr, nullptr});
+}
+template <class T> void infra_lockfree_stack<T>::push(T&& item) noexcept
+{
+    push_node(new node{std::move(item), nullptr, nullptr});
+}
+template <class T> std::optional<T> infra_lockfree_stack<T>::pop() noexcept
+{
+    node* popped;
+    {
+        const hazard_scope hazard{*this};
+        while (true)
+        {
+            node* head = protect(hazard.record);
+            if (!head) return std::nullopt;
+            // the hazard keeps head alive, and its next never changes once it is pushed
+            if (top.compare_exchange_strong(head, head->next, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                popped = head;
+                break;
+            }
+            // an eliminated node was never on the stack, so no other thread can be reading it
+            if (node* const exchanged = take())
+            {
+                std::optional<T> item{std::move(exchanged->value)};
+                delete exchanged;
+                return item;
+            }
+        }
+    }
+    std::optional<T> item;
+    if constexpr (std::is_copy_constructible_v<T>) item.emplace(popped->value);
+    else item.emplace(std::move(popped->value));
+    retire(popped);
+    return item;
+}
+
+template <class T> const bool infra_lockfree_stack<T>::empty() const noexcept
+{
+    return top.load(std::memory_order_acquire) == nullptr;
+}
+
+//-------------------------------//
+
+// Treiber stack and elimination //
+
+template <class T> void infra_lockfree_stack<T>::push_node(node* const pushed) noexcept
+{
+    pushed->next = top.load(std::memory_order_relaxed);
+    while (!top.compare_exchange_strong(pushed->next, pushed, std::memory_order_release, std::memory_order_relaxed))
+    {
+        if (offer(pushed)) return;
+    }
+}
+template <class T> const bool infra_lockfree_stack<T>::offer(node* const pushed) noexcept
+{
+    exchanger& slot = exchangers[thread_hint() % elimination_size];
+    node* expected = nullptr;
+    if (!slot.offer.compare_exchange_strong(expected, pushed, std::memory_order_release, std::memory_order_relaxed)) return false;
+    for (size_type spin = 0; spin < elimination_spins; ++spin)
+    {
+        if (slot.offer.load(std::memory_order_relaxed) == taken()) break;
+    }
+    // withdraw the offer, unless a pop took it in the meantime
+    expected = pushed;
+    if (slot.offer.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed)) return false;
+    slot.offer.store(nullptr, std::memory_order_relaxed);
+    return true;
+}
+template <class T> infra_lockfree_stack<T>::node* infra_lockfree_stack<T>::take() noexcept
+{
+    exchanger& slot = exchangers[thread_hint() % elimination_size];
+    node* offered = slot.offer.load(std::memory_order_relaxed);
+    if (!offered || offered == taken()) return nullptr;
+    // the compare-and-swap only succeeds on a node that is offered right now, whatever happened to the one read above
+    return slot.offer.compare_exchange_strong(offered, taken(), std::memory_order_acquire, std::memory_order_relaxed) ? offered : nullptr;
+}
+template <class T> infra_lockfree_stack<T>::node* infra_lockfree_stack<T>::taken() noexcept
+{
+    return reinterpret_cast<node*>(&taken_marker);
+}
+template <class T> const infra_lockfree_stack<T>::size_type infra_lockfree_stack<T>::thread_hint() noexcept
+{
+    // a per thread xorshift, so that threads spread over the hazard records and the elimination array
+    static thread_local size_type state = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+//-------------------------------//
+
+// hazard pointers //
+
+template <class T> infra_lockfree_stack<T>::hazard_scope::hazard_scope(const infra_lockfree_stack& stack) noexcept
+: record{stack.acquire_record()}
+{
+}
+template <class T> infra_lockfree_stack<T>::hazard_scope::~hazard_scope() noexcept
+{
+    record.pointer.store(nullptr, std::memory_order_release);
+    record.active.store(false, std::memory_order_release);
+}
+
+template <class T> infra_lockfree_stack<T>::hazard_record& infra_lockfree_stack<T>::acquire_record() const noexcept
+{
+    const size_type start = thread_hint();
+    for (size_type i = 0; i <= record_mask; ++i)
+    {
+        hazard_record& record = records[(start + i) & record_mask];
+        if (!record.active.load(std::memory_order_relaxed) && !record.active.exchange(true, std::memory_order_acquire)) return record;
+    }
+    for (hazard_record* record = extra_records.load(std::memory_order_acquire); record; record = record->next_extra)
+    {
+        if (!record->active.load(std::memory_order_relaxed) && !record->active.exchange(true, std::memory_order_acquire)) return *record;
+    }
+    // more threads are in a call than there are records; extra records stay until the stack is destroyed
+    hazard_record* const record = new hazard_record;
+    record->active.store(true, std::memory_order_relaxed);
+    record->next_extra = extra_records.load(std::memory_order_relaxed);
+    while (!extra_records.compare_exchange_weak(record->next_extra, record, std::memory_order_release, std::memory_order_relaxed)) {}
+    return *record;
+}
+template <class T> infra_lockfree_stack<T>::node* infra_lockfree_stack<T>::protect(hazard_record& record) const noexcept
+{
+    // the top read again after publishing the hazard proves that the node was still on the stack once the hazard was visible
+    node* head = top.load(std::memory_order_acquire);
+    while (true)
+    {
+        record.pointer.store(head, std::memory_order_seq_cst);
+        node* const current = top.load(std::memory_order_seq_cst);
+        if (current == head) return head;
+        head = current;
+    }
+}
+template <class T> void infra_lockfree_stack<T>::retire(node* const popped) noexcept
+{
+    popped->retired_next = retired.load(std::memory_order_relaxed);
+    while (!retired.compare_exchange_weak(popped->retired_next, popped, std::memory_order_release, std::memory_order_relaxed)) {}
+    // reclaiming once per several records' worth of retired nodes frees most of them and keeps the scans rare
+    if (retired_count.fetch_add(1, std::memory_order_relaxed) + 1 >= 2 * (record_mask + 1)) reclaim();
+}
+template <class T> void infra_lockfree_stack<T>::reclaim() noexcept
+{
+    retired_count.store(0, std::memory_order_relaxed);
+    node* list = retired.exchange(nullptr, std::memory_order_acquire);
+    std::vector<const node*> hazards;
+    for (size_type i = 0; i <= record_mask; ++i)
+    {
+        if (const node* const pointer = records[i].pointer.load(std::memory_order_seq_cst)) hazards.push_back(pointer);
+    }
+    for (hazard_record* record = extra_records.load(std::memory_order_acquire); record; record = record->next_extra)
+    {
+        if (const node* const pointer = record->pointer.load(std::memory_order_seq_cst)) hazards.push_back(pointer);
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    node* kept = nullptr;
+    node* kept_last = nullptr;
+    size_type kept_count = 0;
+    while (list)
+    {
+        node* const item = std::exchange(list, list->retired_next);
+        if (!std::binary_search(hazards.cbegin(), hazards.cend(), item)) delete item;
+        else
+        {
+            item->retired_next = kept;
+            if (!kept) kept_last = item;
+            kept = item;
+            ++kept_count;
+        }
+    }
+    if (!kept) return;
+    // nodes still in use go back to be checked by a later reclaim
+    kept_last->retired_next = retired.load(std::memory_order_relaxed);
+    while (!retired.compare_exchange_weak(kept_last->retired_next, kept, std::memory_order_release, std::memory_order_relaxed)) {}
+    retired_count.fetch_add(kept_count, std::memory_order_relaxed);
+}
+
+//-----------------//
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * @file mpmc_queue.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra lock-free multi-producer multi-consumer queue class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_MPMC_QUEUE_HPP
+#define SOFTLOQ_WHATWG_INFRA_STRUCTURE_MPMC_QUEUE_HPP
+
+#include "softloq/whatwg/infra/structure/lock.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Bounded lock-free queue (https://infra.spec.whatwg.org/#queues) for any number of producer and consumer threads, with the enqueue, dequeue
+ * and peek of infra_queue. Items live in a ring of slots allocated once. Each slot has a sequence number that tells whether it is free for the
+ * enqueue or filled for the dequeue at a position, so a thread claims a position with one compare-and-swap and never waits on another thread's lock.
+ * Unlike infra_queue it is not a list: it has no iteration or list operations, and its size is only a snapshot while other threads use it. */
+template <class T> class infra_mpmc_queue final
+{
+public:
+    // common member types //
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //---------------------//
+
+    // constructors //
+
+    /**
+     * @brief Constructs an empty WHATWG infra MPMC queue.
+     * @param capacity The most items the queue holds at once, rounded up to a power of two of at least 2. */
+    explicit infra_mpmc_queue(const size_type capacity) noexcept;
+    infra_mpmc_queue(const infra_mpmc_queue& src) = delete;
+    /** @brief Destroys the items left in the queue. No other thread may use the queue any more. */
+    ~infra_mpmc_queue() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_mpmc_queue& operator=(const infra_mpmc_queue& src) = delete;
+
+    //-------------//
+
+    // WHATWG queue member functions //
+
+    /** @brief Adds the item to the end of the queue. Returns false, leaving the item as it is, if the queue is full. */
+    const bool enqueue(const T& item) noexcept;
+    const bool enqueue(T&& item) noexcept;
+    /** @brief Removes the item at the start of the queue and returns it, or returns std::nullopt if the queue is empty. */
+    std::optional<T> dequeue() noexcept;
+    /**
+     * @brief Returns a copy of the item at the start of the queue without removing it, or std::nullopt if the queue is empty.
+     * The copy is taken as a sequence lock reads: the slot's sequence number is read again after copying, and the copy is retried if
+     * a consumer took the item meanwhile. That is only sound for items that can be copied byte by byte. */
+    std::optional<T> peek() const noexcept requires std::is_trivially_copyable_v<T>;
+
+    const size_type capacity() const noexcept;
+    const size_type size() const noexcept;
+    const bool empty() const noexcept;
+
+    //-------------------------------//
+
+private:
+    struct slot
+    {
+        std::atomic<size_type> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    const size_type mask;
+    const std::unique_ptr<slot[]> slots;
+    // producers and consumers each write their own position, so the two are kept on separate cache lines
+    alignas(infra_cache_line_size) std::atomic<size_type> enqueue_position;
+    alignas(infra_cache_line_size) std::atomic<size_type> dequeue_position;
+
+    /**
+     * @brief Word that a trivially copyable item is copied in, as wide as the item's size and alignment allow. Such items are written
+     * and read lane by lane with relaxed atomics, so that peek may read a slot while a producer fills it without a data race. */
+    using lane_type = std::conditional_t<alignof(T) % 8 == 0 && sizeof(T) % 8 == 0, std::uint64_t,
+                      std::conditional_t<alignof(T) % 4 == 0 && sizeof(T) % 4 == 0, std::uint32_t,
+                      std::conditional_t<alignof(T) % 2 == 0 && sizeof(T) % 2 == 0, std::uint16_t, unsigned char>>>;
+    static constexpr size_type lane_count = sizeof(T) / sizeof(lane_type);
+
+    template <class U> const bool emplace(U&& item) noexcept;
+    static void store_lanes(slot& target, const T& item) noexcept;
+    static T load_lanes(const slot& source) noexcept;
+};
+}
+
+#include "softloq/whatwg/infra/structure/mpmc_queue.tpp"
+
+#endif
\ No newline at end of file
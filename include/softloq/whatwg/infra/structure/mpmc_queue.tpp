@@ -0,0 +1,144 @@
+/**
+ * @file mpmc_queue.tpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Template implementation of the WHATWG infra lock-free multi-producer multi-consumer queue class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/structure/mpmc_queue.hpp"
+
+#include <array>
+#include <bit>
+
+namespace softloq::whatwg
+{
+// constructors //
+
+template <class T> infra_mpmc_queue<T>::infra_mpmc_queue(const size_type capacity) noexcept
+: mask{std::bit_ceil(capacity < 2 ? size_type{2} : capacity) - 1}, slots{std::make_unique<slot[]>(mask + 1)}, enqueue_position{0}, dequeue_position{0}
+{
+    // the slot at index i is free for the enqueue at position i
+    for (size_type i = 0; i <= mask; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+template <class T> infra_mpmc_queue<T>::~infra_mpmc_queue() noexcept
+{
+    while (dequeue()) {}
+}
+
+//--------------//
+
+// WHATWG queue member functions //
+
+template <class T> const bool infra_mpmc_queue<T>::enqueue(const T& item) noexcept
+{
+    return emplace(item);
+}
+template <class T> const bool infra_mpmc_queue<T>::enqueue(T&& item) noexcept
+{
+    return emplace(std::move(item));
+}
+template <class T> template <class U> const bool infra_mpmc_queue<T>::emplace(U&& item) noexcept
+{
+    size_type position = enqueue_position.load(std::memory_order_relaxed);
+    slot* claimed;
+    while (true)
+    {
+        claimed = &slots[position & mask];
+        const size_type sequence = claimed->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::make_signed_t<size_type>>(sequence - position);
+        if (difference == 0)
+        {
+            if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        // the slot still holds the item from one lap before, which no consumer has taken yet
+        else if (difference < 0) return false;
+        else position = enqueue_position.load(std::memory_order_relaxed);
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) store_lanes(*claimed, T(std::forward<U>(item)));
+    else std::construct_at(reinterpret_cast<T*>(claimed->storage), std::forward<U>(item));
+    claimed->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+template <class T> std::optional<T> infra_mpmc_queue<T>::dequeue() noexcept
+{
+    size_type position = dequeue_position.load(std::memory_order_relaxed);
+    slot* claimed;
+    while (true)
+    {
+        claimed = &slots[position & mask];
+        const size_type sequence = claimed->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::make_signed_t<size_type>>(sequence - (position + 1));
+        if (difference == 0)
+        {
+            if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else if (difference < 0) return std::nullopt;
+        else position = dequeue_position.load(std::memory_order_relaxed);
+    }
+    std::optional<T> front;
+    if constexpr (std::is_trivially_copyable_v<T>) front.emplace(load_lanes(*claimed));
+    else
+    {
+        T* const item = std::launder(reinterpret_cast<T*>(claimed->storage));
+        front.emplace(std::move(*item));
+        std::destroy_at(item);
+    }
+    // free the slot for the enqueue one lap later
+    claimed->sequence.store(position + mask + 1, std::memory_order_release);
+    return front;
+}
+template <class T> std::optional<T> infra_mpmc_queue<T>::peek() const noexcept requires std::is_trivially_copyable_v<T>
+{
+    while (true)
+    {
+        const size_type position = dequeue_position.load(std::memory_order_acquire);
+        const slot& front = slots[position & mask];
+        const size_type sequence = front.sequence.load(std::memory_order_acquire);
+        if (sequence != position + 1)
+        {
+            if (static_cast<std::make_signed_t<size_type>>(sequence - (position + 1)) < 0) return std::nullopt;
+            continue;
+        }
+        // the copy may be torn by the producer of the next lap, in which case the sequence number has moved on and it is thrown away
+        const T item = load_lanes(front);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (front.sequence.load(std::memory_order_relaxed) == sequence) return item;
+    }
+}
+
+template <class T> const infra_mpmc_queue<T>::size_type infra_mpmc_queue<T>::capacity() const noexcept
+{
+    return mask + 1;
+}
+template <class T> const infra_mpmc_queue<T>::size_type infra_mpmc_queue<T>::size() const noexcept
+{
+    const size_type dequeued = dequeue_position.load(std::memory_order_acquire);
+    const size_type enqueued = enqueue_position.load(std::memory_order_acquire);
+    // a consumer may have moved past the enqueue position read before it
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+template <class T> const bool infra_mpmc_queue<T>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+//-------------------------------//
+
+// slot lanes //
+
+template <class T> void infra_mpmc_queue<T>::store_lanes(slot& target, const T& item) noexcept
+{
+    const auto words = std::bit_cast<std::array<lane_type, lane_count>>(item);
+    lane_type* const lanes = reinterpret_cast<lane_type*>(target.storage);
+    for (size_type i = 0; i < lane_count; ++i) std::atomic_ref<lane_type>{lanes[i]}.store(words[i], std::memory_order_relaxed);
+}
+template <class T> T infra_mpmc_queue<T>::load_lanes(const slot& source) noexcept
+{
+    std::array<lane_type, lane_count> words;
+    // std::atomic_ref cannot refer to a const object; the slots themselves are never const
+    lane_type* const lanes = reinterpret_cast<lane_type*>(const_cast<std::byte*>(source.storage));
+    for (size_type i = 0; i < lane_count; ++i) words[i] = std::atomic_ref<lane_type>{lanes[i]}.load(std::memory_order_relaxed);
+    return std::bit_cast<T>(words);
+}
+
+//------------//
+}
\ No newline at end of file
@@ -9,12 +9,16 @@
 
 #include "softloq/whatwg/infra/structure/list.hpp"
 
+#include <chrono>
+#include <condition_variable>
 #include <optional>
+#include <ranges>
+#include <type_traits>
 
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra queue data structure class. */
-template <class T> class infra_queue final: public infra_list<T>
+template <class T, class Container = std::deque<T>, class Lock = infra_mutex_lock> class infra_queue final: public infra_list<T, Container, Lock>
 {
 public:
     // constructors //
@@ -49,6 +53,12 @@ public:
     void prepend(T&& item) noexcept = delete;
     void pop_front() noexcept = delete;
 
+    // items only enter through enqueue, which wakes the parked consumers
+    void extend(const infra_list<T, Container, Lock>& list) noexcept = delete;
+    void extend(infra_list<T, Container, Lock>&& list) noexcept = delete;
+    void insert(const infra_list<T, Container, Lock>::size_type index, const T& item) noexcept = delete;
+    void insert(const infra_list<T, Container, Lock>::size_type index, T&& item) noexcept = delete;
+
     void remove(const T& item) noexcept = delete;
     void remove_if(const std::function<const bool (const T& item)>& cond) noexcept = delete;
 
@@ -61,7 +71,41 @@ public:
     void enqueue(T&& item) noexcept;
     std::optional<T> dequeue() noexcept;
 
+    /** @brief Calls read with the item at the start of the queue under the lock, without copying it. Returns false if the queue is empty. */
+    const bool peek(const std::function<void (const T& item)>& read) const noexcept;
+    /** @brief Removes the item at the start of the queue and moves it into out. Returns false, leaving out as it is, if the queue is empty. */
+    const bool try_dequeue(T& out) noexcept;
+    /** @brief Removes items from the start of the queue under one lock, moving them in order into the elements of out until either runs out. Returns the number removed. */
+    template <std::ranges::output_range<T> Range> requires std::ranges::sized_range<Range> const infra_list<T, Container, Lock>::size_type dequeue_into(Range&& out) noexcept;
+
+    /**
+     * @brief Removes the item at the start of the queue and returns it, waiting for an enqueue while the queue is empty.
+     * Consumers are woken by enqueue and by assigning to the queue, the only ways items are added. */
+    T wait_dequeue() noexcept;
+    /** @brief Removes the item at the start of the queue and returns it, waiting up to the timeout for an enqueue while the queue is empty. */
+    template <class Rep, class Period> std::optional<T> wait_dequeue_for(const std::chrono::duration<Rep, Period>& timeout) noexcept;
+    /** @brief Removes up to max items from the start of the queue under one lock, moving them in order to out. Returns the number removed. */
+    template <class OutputIt> const infra_list<T, Container, Lock>::size_type dequeue_bulk(OutputIt out, const infra_list<T, Container, Lock>::size_type max) noexcept;
+
     //------------------//
+
+private:
+    // std::condition_variable only waits on a std::mutex; any other mutex of a locking policy needs the general one
+    using condition_type = std::conditional_t<std::is_same_v<typename Lock::mutex_type, std::mutex>, std::condition_variable, std::condition_variable_any>;
+
+    /** @brief Signalled by enqueue, but only when a consumer is parked on it, so that enqueues with no one waiting make no system call. */
+    condition_type available;
+    /** @brief Number of consumers waiting on available, only read and written under the lock so that no wakeup is missed. */
+    typename infra_list<T, Container, Lock>::size_type parked = 0;
+
+    /** @brief Number of times a waiting dequeue yields and tries again before it parks. */
+    static constexpr std::size_t wait_spins = 16;
+
+    template <class U> void emplace(U&& item) noexcept;
+    /** @brief Wakes every parked consumer if the queue has items, after an assignment may have added many at once. */
+    void wake_parked() noexcept;
+    std::optional<T> spin_dequeue() noexcept;
+    T take_front() noexcept;
 };
 }
 
@@ -6,37 +6,151 @@
 
 #include "softloq/whatwg/infra/structure/queue.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
 namespace softloq::whatwg
 {
 // constructors //
 
-template <class T> infra_queue<T>::infra_queue() noexcept {}
-template <class T> infra_queue<T>::infra_queue(const std::initializer_list<T>& values) noexcept : infra_list<T>{values} {}
-template <class T> infra_queue<T>::infra_queue(const infra_queue& src) noexcept : infra_list<T>{src.values} {}
-template <class T> infra_queue<T>::infra_queue(infra_queue&& src) noexcept : infra_list<T>{std::move(src)} {}
-template <class T> infra_queue<T>::~infra_queue() noexcept {}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>::infra_queue() noexcept {}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>::infra_queue(const std::initializer_list<T>& values) noexcept : infra_list<T, Container, Lock>{values} {}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>::infra_queue(const infra_queue& src) noexcept : infra_list<T, Container, Lock>{src} {}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>::infra_queue(infra_queue&& src) noexcept : infra_list<T, Container, Lock>{std::move(src)} {}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>::~infra_queue() noexcept {}
 
 //--------------//
 
 // assignments //
 
-template <class T> infra_queue<T>& infra_queue<T>::operator=(const infra_queue& src) noexcept { infra_list<T>::values = src.values; return *this; }
-template <class T> infra_queue<T>& infra_queue<T>::operator=(infra_queue&& src) noexcept { infra_list<T>::values = std::move(src.values); return *this; }
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>& infra_queue<T, Container, Lock>::operator=(const infra_queue& src) noexcept
+{
+    infra_list<T, Container, Lock>::operator=(src);
+    wake_parked();
+    return *this;
+}
+template <class T, class Container, class Lock> infra_queue<T, Container, Lock>& infra_queue<T, Container, Lock>::operator=(infra_queue&& src) noexcept
+{
+    infra_list<T, Container, Lock>::operator=(std::move(src));
+    wake_parked();
+    return *this;
+}
 
 //-------------//
 
 // WHATWG queue member functions //
 
-template <class T> std::optional<T> infra_queue<T>::peek() const noexcept { return infra_list<T>::empty() ? std::optional<T>{} : infra_list<T>::front(); }
-template <class T> void infra_queue<T>::enqueue(const T& item) noexcept { infra_list<T>::push_back(T); }
-template <class T> void infra_queue<T>::enqueue(T&& item) noexcept { infra_list<T>::push_back(std::move(T)); }
-template <class T> std::optional<T> infra_queue<T>::dequeue() noexcept
+template <class T, class Container, class Lock> std::optional<T> infra_queue<T, Container, Lock>::peek() const noexcept
 {
-    if (infra_list<T>::empty()) return std::optional<T>{};
-    std::optional<T> front = infra_list<T>::front();
-    infra_list<T>::pop_front();
-    return front;
+    // checked and read under one lock, so that no consumer takes the item in between
+    typename infra_list<T, Container, Lock>::read_lock lock(this->mtx);
+    return this->data.empty() ? std::optional<T>{} : this->data.front();
+}
+template <class T, class Container, class Lock> void infra_queue<T, Container, Lock>::enqueue(const T& item) noexcept { emplace(item); }
+template <class T, class Container, class Lock> void infra_queue<T, Container, Lock>::enqueue(T&& item) noexcept { emplace(std::move(item)); }
+template <class T, class Container, class Lock> std::optional<T> infra_queue<T, Container, Lock>::dequeue() noexcept
+{
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    if (this->data.empty()) return std::optional<T>{};
+    return take_front();
+}
+
+
+template <class T, class Container, class Lock> const bool infra_queue<T, Container, Lock>::peek(const std::function<void (const T& item)>& read) const noexcept
+{
+    typename infra_list<T, Container, Lock>::read_lock lock(this->mtx);
+    if (this->data.empty()) return false;
+    read(this->data.front());
+    return true;
+}
+template <class T, class Container, class Lock> const bool infra_queue<T, Container, Lock>::try_dequeue(T& out) noexcept
+{
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    if (this->data.empty()) return false;
+    out = std::move(this->data.front());
+    this->data.erase(this->data.cbegin());
+    return true;
+}
+template <class T, class Container, class Lock> template <std::ranges::output_range<T> Range> requires std::ranges::sized_range<Range> const infra_list<T, Container, Lock>::size_type infra_queue<T, Container, Lock>::dequeue_into(Range&& out) noexcept
+{
+    return dequeue_bulk(std::ranges::begin(out), static_cast<typename infra_list<T, Container, Lock>::size_type>(std::ranges::size(out)));
+}
+template <class T, class Container, class Lock> T infra_queue<T, Container, Lock>::wait_dequeue() noexcept
+{
+    if (std::optional<T> front = spin_dequeue()) return std::move(*front);
+    std::unique_lock<typename Lock::mutex_type> lock(this->mtx);
+    if (this->data.empty())
+    {
+        ++parked;
+        available.wait(lock, [this] { return !this->data.empty(); });
+        --parked;
+    }
+    return take_front();
+}
+template <class T, class Container, class Lock> template <class Rep, class Period> std::optional<T> infra_queue<T, Container, Lock>::wait_dequeue_for(const std::chrono::duration<Rep, Period>& timeout) noexcept
+{
+    if (std::optional<T> front = spin_dequeue()) return front;
+    std::unique_lock<typename Lock::mutex_type> lock(this->mtx);
+    if (this->data.empty())
+    {
+        ++parked;
+        const bool filled = available.wait_for(lock, timeout, [this] { return !this->data.empty(); });
+        --parked;
+        if (!filled) return std::optional<T>{};
+    }
+    return take_front();
+}
+template <class T, class Container, class Lock> template <class OutputIt> const infra_list<T, Container, Lock>::size_type infra_queue<T, Container, Lock>::dequeue_bulk(OutputIt out, const infra_list<T, Container, Lock>::size_type max) noexcept
+{
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    const auto count = std::min(max, static_cast<typename infra_list<T, Container, Lock>::size_type>(this->data.size()));
+    const auto last = std::next(this->data.begin(), count);
+    std::move(this->data.begin(), last, out);
+    this->data.erase(this->data.cbegin(), last);
+    return count;
 }
 
 //------------------//
+
+// queue helpers //
+
+template <class T, class Container, class Lock> template <class U> void infra_queue<T, Container, Lock>::emplace(U&& item) noexcept
+{
+    bool waiting;
+    {
+        typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+        this->data.push_back(std::forward<U>(item));
+        waiting = parked != 0;
+    }
+    // notified after unlocking, so that the woken consumer does not block on the lock again right away
+    if (waiting) available.notify_one();
+}
+template <class T, class Container, class Lock> void infra_queue<T, Container, Lock>::wake_parked() noexcept
+{
+    bool waiting;
+    {
+        typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+        waiting = parked != 0 && !this->data.empty();
+    }
+    if (waiting) available.notify_all();
+}
+template <class T, class Container, class Lock> std::optional<T> infra_queue<T, Container, Lock>::spin_dequeue() noexcept
+{
+    // a producer that is running usually enqueues within a few time slices, which is far cheaper than parking and being woken
+    for (std::size_t spin = 0; spin < wait_spins; ++spin)
+    {
+        if (std::optional<T> front = dequeue()) return front;
+        std::this_thread::yield();
+    }
+    return std::optional<T>{};
+}
+template <class T, class Container, class Lock> T infra_queue<T, Container, Lock>::take_front() noexcept
+{
+    T front{std::move(this->data.front())};
+    this->data.erase(this->data.cbegin());
+    return front;
+}
+
+//-----------------//
 }
\ No newline at end of file
@@ -9,14 +9,17 @@
 
 #include "softloq/whatwg/infra/structure/base.hpp"
 
+#include "softloq/whatwg/infra/structure/lock.hpp"
+
 #include <initializer_list>
 #include <vector>
-#include <mutex>
 
 namespace softloq::whatwg
 {
-/** @brief WHATWG infra sequence data structure template class. Internal container access and iterator functions are thread-safe. */
-template <class T> class infra_sequence : public infra_structure_base
+/**
+ * @brief WHATWG infra sequence data structure template class. Internal container access and iterator functions are thread-safe
+ * under the locking policy, which is infra_mutex_lock by default; infra_no_lock leaves synchronizing to the user. */
+template <class T, class Lock = infra_mutex_lock> class infra_sequence : public infra_structure_base
 {
 public:
 
@@ -25,6 +28,7 @@ public:
     using container_type = std::vector<T>;
     using value_type = T;
     using size_type	= std::size_t;
+    using lock_type = Lock;
 
     //---------------------//
 
@@ -111,6 +115,8 @@ public:
     const size_type size() const noexcept;
     const bool empty() const noexcept;
     void clear() noexcept;
+    /** @brief Resizes the sequence to count items, value initializing the items that are added. */
+    void resize(const size_type count) noexcept;
 
     T& operator[](const size_type index) noexcept;
     const T& operator[](const size_type index) const noexcept;
@@ -126,20 +132,23 @@ public:
 
     // WHATWG sequence comparison functions //
 
-    const bool operator==(const infra_sequence<T>& b) const noexcept;
+    const bool operator==(const infra_sequence& b) const noexcept;
 
     //--------------------------------------//
 
 private:
-    mutable std::mutex mtx;
+    using write_lock = Lock::write_lock;
+    using read_lock = Lock::read_lock;
+
+    [[no_unique_address]] mutable Lock::mutex_type mtx;
     std::vector<T> data;
     
-    infra_sequence(const infra_sequence& src, const std::lock_guard<std::mutex>&) noexcept;
-    infra_sequence(infra_sequence&& src, const std::lock_guard<std::mutex>&) noexcept;
+    infra_sequence(const infra_sequence& src, const read_lock&) noexcept;
+    infra_sequence(infra_sequence&& src, const write_lock&) noexcept;
 };
 
-template <class T> infra_sequence<T> operator+(const infra_sequence<T>& a, const infra_sequence<T>& b) noexcept;
-template <class T> infra_sequence<T> operator+(const infra_sequence<T>& a, const T& b) noexcept;
+template <class T, class Lock> infra_sequence<T, Lock> operator+(const infra_sequence<T, Lock>& a, const infra_sequence<T, Lock>& b) noexcept;
+template <class T, class Lock> infra_sequence<T, Lock> operator+(const infra_sequence<T, Lock>& a, const T& b) noexcept;
 }
 
 #include "softloq/whatwg/infra/structure/sequence.tpp"
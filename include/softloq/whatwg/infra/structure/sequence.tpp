@@ -11,30 +11,30 @@ namespace softloq::whatwg
 {
 // constructors //
 
-template <class T> infra_sequence<T>::infra_sequence() noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence() noexcept
 {
 }
-template <class T> infra_sequence<T>::infra_sequence(const std::initializer_list<T>& values) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence(const std::initializer_list<T>& values) noexcept
 : data(values)
 {
 }
-template <class T> infra_sequence<T>::infra_sequence(const infra_sequence& src) noexcept
-: infra_sequence(src, std::lock_guard<std::mutex>(src.mtx))
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence(const infra_sequence& src) noexcept
+: infra_sequence(src, read_lock(src.mtx))
 {
 }
-template <class T> infra_sequence<T>::infra_sequence(infra_sequence&& src) noexcept
-: infra_sequence(std::move(src), std::lock_guard<std::mutex>(src.mtx))
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence(infra_sequence&& src) noexcept
+: infra_sequence(std::move(src), write_lock(src.mtx))
 {
 }
-template <class T> infra_sequence<T>::infra_sequence(const infra_sequence& src, const std::lock_guard<std::mutex>&) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence(const infra_sequence& src, const read_lock&) noexcept
 : data(src.data)
 {
 }
-template <class T> infra_sequence<T>::infra_sequence(infra_sequence&& src, const std::lock_guard<std::mutex>&) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::infra_sequence(infra_sequence&& src, const write_lock&) noexcept
 : data(std::move(src.data))
 {
 }
-template <class T> infra_sequence<T>::~infra_sequence() noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::~infra_sequence() noexcept
 {
 }
 
@@ -42,17 +42,17 @@ template <class T> infra_sequence<T>::~infra_sequence() noexcept
 
 // assignments //
 
-template <class T> infra_sequence<T>& infra_sequence<T>::operator=(const infra_sequence& src) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>& infra_sequence<T, Lock>::operator=(const infra_sequence& src) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> src_lock(src.mtx);
+    write_lock lock(mtx);
+    read_lock src_lock(src.mtx);
     data = src.data;
     return *this;
 }
-template <class T> infra_sequence<T>& infra_sequence<T>::operator=(infra_sequence&& src) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>& infra_sequence<T, Lock>::operator=(infra_sequence&& src) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> src_lock(src.mtx);
+    write_lock lock(mtx);
+    write_lock src_lock(src.mtx);
     data = std::move(src.data);
     return *this;
 }
@@ -61,67 +61,67 @@ template <class T> infra_sequence<T>& infra_sequence<T>::operator=(infra_sequenc
 
 // iterator member functions //
 
-template <class T> infra_sequence<T>::iterator infra_sequence<T>::begin()
+template <class T, class Lock> infra_sequence<T, Lock>::iterator infra_sequence<T, Lock>::begin()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.begin();
 }
-template <class T> infra_sequence<T>::const_iterator infra_sequence<T>::begin() const
+template <class T, class Lock> infra_sequence<T, Lock>::const_iterator infra_sequence<T, Lock>::begin() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.begin();
 }
-template <class T> infra_sequence<T>::const_iterator infra_sequence<T>::cbegin() const noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::const_iterator infra_sequence<T, Lock>::cbegin() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.cbegin();
 }
 
-template <class T> infra_sequence<T>::iterator infra_sequence<T>::end()
+template <class T, class Lock> infra_sequence<T, Lock>::iterator infra_sequence<T, Lock>::end()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.end();
 }
-template <class T> infra_sequence<T>::const_iterator infra_sequence<T>::end() const
+template <class T, class Lock> infra_sequence<T, Lock>::const_iterator infra_sequence<T, Lock>::end() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.end();
 }
-template <class T> infra_sequence<T>::const_iterator infra_sequence<T>::cend() const noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::const_iterator infra_sequence<T, Lock>::cend() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.cend();
 }
 
-template <class T> infra_sequence<T>::reverse_iterator infra_sequence<T>::rbegin()
+template <class T, class Lock> infra_sequence<T, Lock>::reverse_iterator infra_sequence<T, Lock>::rbegin()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.rbegin();
 }
-template <class T> infra_sequence<T>::const_reverse_iterator infra_sequence<T>::rbegin() const
+template <class T, class Lock> infra_sequence<T, Lock>::const_reverse_iterator infra_sequence<T, Lock>::rbegin() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.rbegin();
 }
-template <class T> infra_sequence<T>::const_reverse_iterator infra_sequence<T>::crbegin() const noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::const_reverse_iterator infra_sequence<T, Lock>::crbegin() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.crbegin();
 }
 
-template <class T> infra_sequence<T>::reverse_iterator infra_sequence<T>::rend()
+template <class T, class Lock> infra_sequence<T, Lock>::reverse_iterator infra_sequence<T, Lock>::rend()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.rend();
 }
-template <class T> infra_sequence<T>::const_reverse_iterator infra_sequence<T>::rend() const
+template <class T, class Lock> infra_sequence<T, Lock>::const_reverse_iterator infra_sequence<T, Lock>::rend() const
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.rend();
 }
-template <class T> infra_sequence<T>::const_reverse_iterator infra_sequence<T>::crend() const noexcept
+template <class T, class Lock> infra_sequence<T, Lock>::const_reverse_iterator infra_sequence<T, Lock>::crend() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.crend();
 }
 
@@ -129,96 +129,100 @@ template <class T> infra_sequence<T>::const_reverse_iterator infra_sequence<T>::
 
 // WHATWG sequence member functions //
 
-template <class T> T& infra_sequence<T>::front() noexcept
+template <class T, class Lock> T& infra_sequence<T, Lock>::front() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.front();
 }
-template <class T> const T& infra_sequence<T>::front() const noexcept
+template <class T, class Lock> const T& infra_sequence<T, Lock>::front() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.front();
 }
-template <class T> T& infra_sequence<T>::back() noexcept
+template <class T, class Lock> T& infra_sequence<T, Lock>::back() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data.back();
 }
-template <class T> const T& infra_sequence<T>::back() const noexcept
+template <class T, class Lock> const T& infra_sequence<T, Lock>::back() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.back();
 }
 
-template <class T> infra_sequence<T>& infra_sequence<T>::operator+=(const infra_sequence& sequence) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>& infra_sequence<T, Lock>::operator+=(const infra_sequence& sequence) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> sequence_lock(sequence.mtx);
+    write_lock lock(mtx);
+    read_lock sequence_lock(sequence.mtx);
     for (const auto& item: sequence.data) data.push_back(item);
     return *this;
 }
 
-template <class T> infra_sequence<T>& infra_sequence<T>::operator+=(const T& item) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>& infra_sequence<T, Lock>::operator+=(const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(item);
     return *this;
 }
-template <class T> infra_sequence<T>& infra_sequence<T>::operator+=(T&& item) noexcept
+template <class T, class Lock> infra_sequence<T, Lock>& infra_sequence<T, Lock>::operator+=(T&& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(item);
     return *this;
 }
 
-template <class T> void infra_sequence<T>::extend(const infra_sequence<T>& sequence) noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::extend(const infra_sequence& sequence) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> sequence_lock(sequence.mtx);
+    write_lock lock(mtx);
+    read_lock sequence_lock(sequence.mtx);
     for (const auto& item: sequence.data) data.push_back(item);
-    return *this;
 }
 
-template <class T> void infra_sequence<T>::push_back(const T& item) noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::push_back(const T& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(item);
 }
-template <class T> void infra_sequence<T>::push_back(T&& item) noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::push_back(T&& item) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.push_back(std::move(item));
 }
-template <class T> void infra_sequence<T>::pop_back() noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::pop_back() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.pop_back();
 }
 
-template <class T> const infra_sequence<T>::size_type infra_sequence<T>::size() const noexcept
+template <class T, class Lock> const infra_sequence<T, Lock>::size_type infra_sequence<T, Lock>::size() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.size();
 }
-template <class T> const bool infra_sequence<T>::empty() const noexcept
+template <class T, class Lock> const bool infra_sequence<T, Lock>::empty() const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data.empty();
 }
-template <class T> void infra_sequence<T>::clear() noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::clear() noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     data.clear();
 }
+template <class T, class Lock> void infra_sequence<T, Lock>::resize(const size_type count) noexcept
+{
+    write_lock lock(mtx);
+    data.resize(count);
+}
 
-template <class T> T& infra_sequence<T>::operator[](const size_type index) noexcept
+template <class T, class Lock> T& infra_sequence<T, Lock>::operator[](const size_type index) noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    write_lock lock(mtx);
     return data[index];
 }
-template <class T> const T& infra_sequence<T>::operator[](const size_type index) const noexcept
+template <class T, class Lock> const T& infra_sequence<T, Lock>::operator[](const size_type index) const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     return data[index];
 }
 
@@ -226,13 +230,13 @@ template <class T> const T& infra_sequence<T>::operator[](const size_type index)
 
 // WHATWG structure base overrides //
 
-template <class T> const infra_structure_type infra_sequence<T>::structure_type() const noexcept
+template <class T, class Lock> const infra_structure_type infra_sequence<T, Lock>::structure_type() const noexcept
 {
     return infra_structure_type::infra_sequence;
 }
-template <class T> void infra_sequence<T>::print(std::ostream& out) const noexcept
+template <class T, class Lock> void infra_sequence<T, Lock>::print(std::ostream& out) const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    read_lock lock(mtx);
     auto curr_it = data.cbegin();
     auto last_it = data.cend();
     for(const T& item: data)
@@ -246,23 +250,23 @@ template <class T> void infra_sequence<T>::print(std::ostream& out) const noexce
 
 // WHATWG sequence comparison functions //
 
-template <class T> const bool infra_sequence<T>::operator==(const infra_sequence<T>& b) const noexcept
+template <class T, class Lock> const bool infra_sequence<T, Lock>::operator==(const infra_sequence& b) const noexcept
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::lock_guard<std::mutex> b_lock(b.mtx);
+    read_lock lock(mtx);
+    read_lock b_lock(b.mtx);
     return data == b.data;
 }
 
 //--------------------------------------//
 
-template <class T> infra_sequence<T> operator+(const infra_sequence<T>& a, const infra_sequence<T>& b) noexcept
+template <class T, class Lock> infra_sequence<T, Lock> operator+(const infra_sequence<T, Lock>& a, const infra_sequence<T, Lock>& b) noexcept
 {
-    infra_sequence<T> combine{a};
+    infra_sequence<T, Lock> combine{a};
     return combine += b;
 }
-template <class T> infra_sequence<T> operator+(const infra_sequence<T>& a, const T& b) noexcept
+template <class T, class Lock> infra_sequence<T, Lock> operator+(const infra_sequence<T, Lock>& a, const T& b) noexcept
 {
-    infra_sequence<T> combine{a};
+    infra_sequence<T, Lock> combine{a};
     return combine += b;
 }
 }
\ No newline at end of file
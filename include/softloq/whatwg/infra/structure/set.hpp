@@ -1,39 +1,193 @@
-// /**
-//  * @file set.hpp
-//  * @author Brandon Foster (https://github.com/BrandonFoster)
-//  * @brief Declaration of the WHATWG infra set data structure class.
-//  * @version 1.0.0 */
-
-// #ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_SET_HPP
-// #define SOFTLOQ_WHATWG_INFRA_STRUCTURE_SET_HPP
-
-// #include "softloq/whatwg/infra/structure/list.hpp"
-
-// namespace softloq::whatwg
-// {
-// /** @brief WHATWG infra set data structure class. */
-// template <class T> class infra_set : public infra_list<T>
-// {
-// public:
-//     // Standard member types //
-
-//     using value_type = T;
-//     using size_type	= infra_list<T>::size_type;
-//     using reference = value_type&;
-//     using const_reference = const value_type&;
-//     using iterator = infra_list<T>::iterator;
-//     using const_iterator = infra_list<T>::const_iterator;
-//     using reverse_iterator = infra_list<T>::reverse_iterator;
-//     using const_reverse_iterator = infra_list<T>::const_reverse_iterator;
-
-//     //-----------------------//
-
-//     // Member functions //
-    
-//     //------------------//
-// };
-// }
-
-// #include "softloq/whatwg/infra/structure/set.tpp"
-
-// #endif
\ No newline at end of file
+/**
+ * @file set.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra ordered set data structure class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_SET_HPP
+#define SOFTLOQ_WHATWG_INFRA_STRUCTURE_SET_HPP
+
+#include "softloq/whatwg/infra/structure/list.hpp"
+
+#include <vector>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief WHATWG infra ordered set data structure template class (https://infra.spec.whatwg.org/#ordered-set). Thread-safe under the locking policy,
+ * as infra_list is. The items are kept in insertion order in one dense array, which iteration walks, and a hash index of their positions
+ * answers whether an item is in the set in constant time, so appending many items that may repeat is linear instead of quadratic.
+ * Items can only be read in place, since changing one would leave it at the wrong place in the index. */
+template <class T, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, class Lock = infra_mutex_lock> class infra_ordered_set : public infra_structure_base
+{
+public:
+
+    // common member types //
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using lock_type = Lock;
+
+    //---------------------//
+
+    // iterator member types //
+
+    using iterator = std::vector<T>::const_iterator;
+    using const_iterator = std::vector<T>::const_iterator;
+    using reverse_iterator = std::vector<T>::const_reverse_iterator;
+    using const_reverse_iterator = std::vector<T>::const_reverse_iterator;
+
+    //-----------------------//
+
+    // constructors //
+
+    /** @brief Constructs an empty WHATWG infra ordered set. */
+    infra_ordered_set() noexcept;
+    /**
+     * @brief Constructs a WHATWG infra ordered set with an initializer list of values, keeping the first of any repeated value.
+     * @param values The initializer list for the ordered set. */
+    infra_ordered_set(const std::initializer_list<T>& values) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra ordered set with the items of a list in order, keeping the first of any repeated item.
+     * @param list The infra list whose items will be copied. */
+    template <class Container, class ListLock> explicit infra_ordered_set(const infra_list<T, Container, ListLock>& list) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra ordered set from another infra ordered set.
+     * @param src The infra ordered set that will be copied. */
+    infra_ordered_set(const infra_ordered_set& src) noexcept;
+    /**
+     * @brief Constructs a WHATWG infra ordered set from another infra ordered set.
+     * @param src The infra ordered set that will be moved. */
+    infra_ordered_set(infra_ordered_set&& src) noexcept;
+    ~infra_ordered_set() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    /**
+     * @brief Assigns the WHATWG infra ordered set from another infra ordered set.
+     * @param src The infra ordered set that will be copied. */
+    infra_ordered_set& operator=(const infra_ordered_set& src) noexcept;
+    /**
+     * @brief Assigns the WHATWG infra ordered set from another infra ordered set.
+     * @param src The infra ordered set that will be moved. */
+    infra_ordered_set& operator=(infra_ordered_set&& src) noexcept;
+
+    //-------------//
+
+    // iterator member functions //
+
+    const_iterator begin() const;
+    const_iterator cbegin() const noexcept;
+
+    const_iterator end() const;
+    const_iterator cend() const noexcept;
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const noexcept;
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const noexcept;
+
+    //---------------------------//
+
+    // WHATWG ordered set member functions //
+
+    const T& front() const noexcept;
+    const T& back() const noexcept;
+
+    /** @brief Adds the item to the end of the set (https://infra.spec.whatwg.org/#set-append). Returns false, leaving the set as it is, if the set already contains it. */
+    const bool append(const T& item) noexcept;
+    const bool append(T&& item) noexcept;
+    /** @brief Adds the item to the start of the set (https://infra.spec.whatwg.org/#set-prepend). Returns false, leaving the set as it is, if the set already contains it. */
+    const bool prepend(const T& item) noexcept;
+    const bool prepend(T&& item) noexcept;
+    /** @brief Appends each item of the set in order (https://infra.spec.whatwg.org/#set-extend). */
+    void extend(const infra_ordered_set& set) noexcept;
+
+    /**
+     * @brief If the set contains the item or the replacement, replaces the first of them with the replacement and removes the other
+     * (https://infra.spec.whatwg.org/#set-replace). */
+    void replace(const T& item, const T& replacement) noexcept;
+
+    void remove(const T& item) noexcept;
+    void remove_if(const std::function<const bool (const T& item)>& cond) noexcept;
+
+    const size_type size() const noexcept;
+    const bool empty() const noexcept;
+    void clear() noexcept;
+
+    /** @brief Checks if the set contains the item. Constant time on average. */
+    const bool contains(const T& item) const noexcept;
+    /** @brief Performs the steps on each item in order, holding the read lock for the whole walk. The steps must not change the set. */
+    void for_each(const std::function<void (const T& item)>& steps) const noexcept;
+    infra_ordered_set clone() const noexcept;
+
+    /** @brief Checks if the set contains every item of the other set (https://infra.spec.whatwg.org/#set-subset). */
+    const bool is_subset(const infra_ordered_set& set) const noexcept;
+    /** @brief Checks if the other set contains every item of the set (https://infra.spec.whatwg.org/#set-superset). */
+    const bool is_superset(const infra_ordered_set& set) const noexcept;
+    /** @brief Checks if the sets hold the same items, in any order (https://infra.spec.whatwg.org/#set-equal). */
+    const bool operator==(const infra_ordered_set& set) const noexcept;
+
+    /** @brief Returns the items of the set followed by the items of the other set that it does not contain (https://infra.spec.whatwg.org/#set-union). Named so since union is a keyword. */
+    infra_ordered_set set_union(const infra_ordered_set& set) const noexcept;
+    /** @brief Returns the items of the set that the other set contains, in order (https://infra.spec.whatwg.org/#set-intersection). */
+    infra_ordered_set intersection(const infra_ordered_set& set) const noexcept;
+    /** @brief Returns the items of the set that the other set does not contain, in order (https://infra.spec.whatwg.org/#set-difference). */
+    infra_ordered_set difference(const infra_ordered_set& set) const noexcept;
+
+    //-------------------------------------//
+
+    // WHATWG structure base overrides //
+
+    const infra_structure_type structure_type() const noexcept override;
+    void print(std::ostream& out) const noexcept override;
+
+    //---------------------------------//
+
+protected:
+    using write_lock = Lock::write_lock;
+    using read_lock = Lock::read_lock;
+
+    [[no_unique_address]] mutable Lock::mutex_type mtx;
+    std::vector<T> data;
+
+private:
+    /** @brief A position in data with the hash of the item there, kept so that the index grows without hashing the items again. */
+    struct index_slot
+    {
+        size_type position;
+        std::size_t hash;
+    };
+    static constexpr size_type no_position = static_cast<size_type>(-1);
+
+    /** @brief Open addressing table with linear probing, at most half full, whose size is zero or a power of two. */
+    std::vector<index_slot> index;
+    [[no_unique_address]] Hash hash_item;
+    [[no_unique_address]] KeyEqual equal_item;
+
+    infra_ordered_set(const infra_ordered_set& src, const read_lock&) noexcept;
+    infra_ordered_set(infra_ordered_set&& src, const write_lock&) noexcept;
+
+    /** @brief Takes the locks of two sets in address order, so that two threads combining the same sets the other way round cannot deadlock. */
+    template <class FirstLock, class SecondLock, class Steps> static decltype(auto) lock_both(const infra_ordered_set& first, const infra_ordered_set& second, const Steps& steps) noexcept;
+
+    // the following expect the caller to hold the lock
+    const size_type find_slot(const T& item, const std::size_t hash) const noexcept;
+    const size_type position_of(const T& item) const noexcept;
+    template <class U> const bool add(U&& item, const bool at_front) noexcept;
+    void erase_at(const size_type position) noexcept;
+    void insert_slot(const size_type position, const std::size_t hash) noexcept;
+    void erase_slot(size_type slot) noexcept;
+    void reserve_index(const size_type count) noexcept;
+    void rebuild_index() noexcept;
+};
+}
+
+#include "softloq/whatwg/infra/structure/set.tpp"
+
+#endif
\ No newline at end of file
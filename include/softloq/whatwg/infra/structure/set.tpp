@@ -1,11 +1,399 @@
-// /**
-//  * @file set.tpp
-//  * @author Brandon Foster (https://github.com/BrandonFoster)
-//  * @brief Template implementation of the WHATWG infra set data structure class.
-//  * @version 1.0.0 */
+/**
+ * @file set.tpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Template implementation of the WHATWG infra ordered set data structure class.
+ * @version 1.0.0 */
 
-// #include "softloq/whatwg/infra/structure/set.hpp"
+#include "softloq/whatwg/infra/structure/set.hpp"
 
-// namespace softloq::whatwg
-// {
-// }
\ No newline at end of file
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace softloq::whatwg
+{
+// constructors //
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set() noexcept
+{
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(const std::initializer_list<T>& values) noexcept
+{
+    data.reserve(values.size());
+    reserve_index(values.size());
+    for (const T& item: values) add(item, false);
+}
+template <class T, class Hash, class KeyEqual, class Lock> template <class Container, class ListLock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(const infra_list<T, Container, ListLock>& list) noexcept
+{
+    list.for_each([this](const T& item) { add(item, false); });
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(const infra_ordered_set& src) noexcept
+: infra_ordered_set(src, read_lock(src.mtx))
+{
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(infra_ordered_set&& src) noexcept
+: infra_ordered_set(std::move(src), write_lock(src.mtx))
+{
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(const infra_ordered_set& src, const read_lock&) noexcept
+: data(src.data), index(src.index), hash_item(src.hash_item), equal_item(src.equal_item)
+{
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::infra_ordered_set(infra_ordered_set&& src, const write_lock&) noexcept
+: data(std::move(src.data)), index(std::move(src.index)), hash_item(std::move(src.hash_item)), equal_item(std::move(src.equal_item))
+{
+    src.data.clear();
+    src.index.clear();
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::~infra_ordered_set() noexcept
+{
+}
+
+//--------------//
+
+// assignments //
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>& infra_ordered_set<T, Hash, KeyEqual, Lock>::operator=(const infra_ordered_set& src) noexcept
+{
+    if (this == &src) return *this;
+    lock_both<write_lock, read_lock>(*this, src, [&]
+    {
+        data = src.data;
+        index = src.index;
+    });
+    return *this;
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>& infra_ordered_set<T, Hash, KeyEqual, Lock>::operator=(infra_ordered_set&& src) noexcept
+{
+    if (this == &src) return *this;
+    lock_both<write_lock, write_lock>(*this, src, [&]
+    {
+        data = std::move(src.data);
+        index = std::move(src.index);
+        src.data.clear();
+        src.index.clear();
+    });
+    return *this;
+}
+
+//-------------//
+
+// iterator member functions //
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::begin() const
+{
+    read_lock lock(mtx);
+    return data.begin();
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::cbegin() const noexcept
+{
+    read_lock lock(mtx);
+    return data.cbegin();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::end() const
+{
+    read_lock lock(mtx);
+    return data.end();
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::cend() const noexcept
+{
+    read_lock lock(mtx);
+    return data.cend();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_reverse_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::rbegin() const
+{
+    read_lock lock(mtx);
+    return data.rbegin();
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_reverse_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::crbegin() const noexcept
+{
+    read_lock lock(mtx);
+    return data.crbegin();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_reverse_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::rend() const
+{
+    read_lock lock(mtx);
+    return data.rend();
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::const_reverse_iterator infra_ordered_set<T, Hash, KeyEqual, Lock>::crend() const noexcept
+{
+    read_lock lock(mtx);
+    return data.crend();
+}
+
+//---------------------------//
+
+// WHATWG ordered set member functions //
+
+template <class T, class Hash, class KeyEqual, class Lock> const T& infra_ordered_set<T, Hash, KeyEqual, Lock>::front() const noexcept
+{
+    read_lock lock(mtx);
+    return data.front();
+}
+template <class T, class Hash, class KeyEqual, class Lock> const T& infra_ordered_set<T, Hash, KeyEqual, Lock>::back() const noexcept
+{
+    read_lock lock(mtx);
+    return data.back();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::append(const T& item) noexcept
+{
+    write_lock lock(mtx);
+    return add(item, false);
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::append(T&& item) noexcept
+{
+    write_lock lock(mtx);
+    return add(std::move(item), false);
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::prepend(const T& item) noexcept
+{
+    write_lock lock(mtx);
+    return add(item, true);
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::prepend(T&& item) noexcept
+{
+    write_lock lock(mtx);
+    return add(std::move(item), true);
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::extend(const infra_ordered_set& set) noexcept
+{
+    // a set already contains each of its own items
+    if (this == &set) return;
+    lock_both<write_lock, read_lock>(*this, set, [&]
+    {
+        reserve_index(data.size() + set.data.size());
+        for (const T& item: set.data) add(item, false);
+    });
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::replace(const T& item, const T& replacement) noexcept
+{
+    write_lock lock(mtx);
+    const size_type item_position = position_of(item);
+    if (item_position == no_position || equal_item(item, replacement)) return;
+    const size_type replacement_position = position_of(replacement);
+    // the replacement comes first, so only the item has to go
+    if (replacement_position < item_position)
+    {
+        erase_at(item_position);
+        return;
+    }
+    // positions before the replacement's stay put when it is erased
+    if (replacement_position != no_position) erase_at(replacement_position);
+    erase_slot(find_slot(item, hash_item(item)));
+    data[item_position] = replacement;
+    insert_slot(item_position, hash_item(replacement));
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::remove(const T& item) noexcept
+{
+    write_lock lock(mtx);
+    const size_type position = position_of(item);
+    if (position != no_position) erase_at(position);
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::remove_if(const std::function<const bool (const T& item)>& cond) noexcept
+{
+    write_lock lock(mtx);
+    if (std::erase_if(data, cond) != 0) rebuild_index();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> const infra_ordered_set<T, Hash, KeyEqual, Lock>::size_type infra_ordered_set<T, Hash, KeyEqual, Lock>::size() const noexcept
+{
+    read_lock lock(mtx);
+    return data.size();
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::empty() const noexcept
+{
+    read_lock lock(mtx);
+    return data.empty();
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::clear() noexcept
+{
+    write_lock lock(mtx);
+    data.clear();
+    index.clear();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::contains(const T& item) const noexcept
+{
+    read_lock lock(mtx);
+    return position_of(item) != no_position;
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::for_each(const std::function<void (const T& item)>& steps) const noexcept
+{
+    read_lock lock(mtx);
+    for (const auto& x: data) steps(x);
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::clone() const noexcept
+{
+    return *this;
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::is_subset(const infra_ordered_set& set) const noexcept
+{
+    return set.is_superset(*this);
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::is_superset(const infra_ordered_set& set) const noexcept
+{
+    return lock_both<read_lock, read_lock>(*this, set, [&]
+    {
+        return set.data.size() <= data.size() && std::all_of(set.data.cbegin(), set.data.cend(), [this](const T& item) { return position_of(item) != no_position; });
+    });
+}
+template <class T, class Hash, class KeyEqual, class Lock> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::operator==(const infra_ordered_set& set) const noexcept
+{
+    // with equal sizes and no repeated items, one set containing the other means both contain each other
+    return lock_both<read_lock, read_lock>(*this, set, [&]
+    {
+        return set.data.size() == data.size() && std::all_of(set.data.cbegin(), set.data.cend(), [this](const T& item) { return position_of(item) != no_position; });
+    });
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::set_union(const infra_ordered_set& set) const noexcept
+{
+    infra_ordered_set result{*this};
+    result.extend(set);
+    return result;
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::intersection(const infra_ordered_set& set) const noexcept
+{
+    infra_ordered_set result;
+    lock_both<read_lock, read_lock>(*this, set, [&]
+    {
+        for (const T& item: data) if (set.position_of(item) != no_position) result.add(item, false);
+    });
+    return result;
+}
+template <class T, class Hash, class KeyEqual, class Lock> infra_ordered_set<T, Hash, KeyEqual, Lock> infra_ordered_set<T, Hash, KeyEqual, Lock>::difference(const infra_ordered_set& set) const noexcept
+{
+    infra_ordered_set result;
+    lock_both<read_lock, read_lock>(*this, set, [&]
+    {
+        for (const T& item: data) if (set.position_of(item) == no_position) result.add(item, false);
+    });
+    return result;
+}
+
+//-------------------------------------//
+
+// hash index //
+
+template <class T, class Hash, class KeyEqual, class Lock> template <class FirstLock, class SecondLock, class Steps> decltype(auto) infra_ordered_set<T, Hash, KeyEqual, Lock>::lock_both(const infra_ordered_set& first, const infra_ordered_set& second, const Steps& steps) noexcept
+{
+    if (&first == &second)
+    {
+        FirstLock lock(first.mtx);
+        return steps();
+    }
+    if (std::less<const infra_ordered_set*>{}(&first, &second))
+    {
+        FirstLock first_lock(first.mtx);
+        SecondLock second_lock(second.mtx);
+        return steps();
+    }
+    SecondLock second_lock(second.mtx);
+    FirstLock first_lock(first.mtx);
+    return steps();
+}
+
+template <class T, class Hash, class KeyEqual, class Lock> const infra_ordered_set<T, Hash, KeyEqual, Lock>::size_type infra_ordered_set<T, Hash, KeyEqual, Lock>::find_slot(const T& item, const std::size_t hash) const noexcept
+{
+    // the index is never full, so the probe always ends at the item or at an empty slot
+    const size_type mask = index.size() - 1;
+    for (size_type slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        const index_slot& entry = index[slot];
+        if (entry.position == no_position || (entry.hash == hash && equal_item(data[entry.position], item))) return slot;
+    }
+}
+template <class T, class Hash, class KeyEqual, class Lock> const infra_ordered_set<T, Hash, KeyEqual, Lock>::size_type infra_ordered_set<T, Hash, KeyEqual, Lock>::position_of(const T& item) const noexcept
+{
+    if (data.empty()) return no_position;
+    return index[find_slot(item, hash_item(item))].position;
+}
+template <class T, class Hash, class KeyEqual, class Lock> template <class U> const bool infra_ordered_set<T, Hash, KeyEqual, Lock>::add(U&& item, const bool at_front) noexcept
+{
+    reserve_index(data.size() + 1);
+    const std::size_t hash = hash_item(item);
+    const size_type slot = find_slot(item, hash);
+    if (index[slot].position != no_position) return false;
+    if (at_front)
+    {
+        // every item moves up one place
+        for (index_slot& entry: index) if (entry.position != no_position) ++entry.position;
+        data.insert(data.cbegin(), std::forward<U>(item));
+        index[slot] = {0, hash};
+    }
+    else
+    {
+        index[slot] = {data.size(), hash};
+        data.push_back(std::forward<U>(item));
+    }
+    return true;
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::erase_at(const size_type position) noexcept
+{
+    erase_slot(find_slot(data[position], hash_item(data[position])));
+    data.erase(std::next(data.cbegin(), position));
+    // every item after it moves down one place
+    for (index_slot& entry: index) if (entry.position != no_position && entry.position > position) --entry.position;
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::insert_slot(const size_type position, const std::size_t hash) noexcept
+{
+    const size_type mask = index.size() - 1;
+    size_type slot = hash & mask;
+    while (index[slot].position != no_position) slot = (slot + 1) & mask;
+    index[slot] = {position, hash};
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::erase_slot(size_type slot) noexcept
+{
+    // backward shift deletion: later entries of the probe run move into the hole if that does not put them before their home slot,
+    // which keeps every run unbroken without tombstones
+    const size_type mask = index.size() - 1;
+    for (size_type next = (slot + 1) & mask; index[next].position != no_position; next = (next + 1) & mask)
+    {
+        const size_type home = index[next].hash & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            index[slot] = index[next];
+            slot = next;
+        }
+    }
+    index[slot].position = no_position;
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::reserve_index(const size_type count) noexcept
+{
+    if (count * 2 <= index.size()) return;
+    std::vector<index_slot> previous = std::exchange(index, std::vector<index_slot>(std::bit_ceil(std::max<size_type>(8, count * 2)), index_slot{no_position, 0}));
+    for (const index_slot& entry: previous) if (entry.position != no_position) insert_slot(entry.position, entry.hash);
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::rebuild_index() noexcept
+{
+    index.assign(data.empty() ? 0 : std::bit_ceil(std::max<size_type>(8, data.size() * 2)), index_slot{no_position, 0});
+    for (size_type position = 0; position < data.size(); ++position) insert_slot(position, hash_item(data[position]));
+}
+
+//------------//
+
+// WHATWG structure base overrides //
+
+template <class T, class Hash, class KeyEqual, class Lock> const infra_structure_type infra_ordered_set<T, Hash, KeyEqual, Lock>::structure_type() const noexcept
+{
+    return infra_structure_type::infra_ordered_set;
+}
+template <class T, class Hash, class KeyEqual, class Lock> void infra_ordered_set<T, Hash, KeyEqual, Lock>::print(std::ostream& out) const noexcept
+{
+    read_lock lock(mtx);
+    auto curr_it = data.cbegin();
+    auto last_it = data.cend();
+    out << "« ";
+    for(const T& item: data) out << item << (++curr_it != last_it ? ", " : " ");
+    out << "»";
+}
+
+//---------------------------------//
+}
\ No newline at end of file
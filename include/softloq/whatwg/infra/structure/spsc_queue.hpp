@@ -0,0 +1,97 @@
+/**
+ * @file spsc_queue.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the WHATWG infra wait-free single-producer single-consumer queue class.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_STRUCTURE_SPSC_QUEUE_HPP
+#define SOFTLOQ_WHATWG_INFRA_STRUCTURE_SPSC_QUEUE_HPP
+
+#include "softloq/whatwg/infra/structure/lock.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+namespace softloq::whatwg
+{
+/**
+ * @brief Bounded wait-free queue (https://infra.spec.whatwg.org/#queues) for exactly one producer thread and one consumer thread, such as
+ * two stages of a pipeline. Items live in a ring of slots allocated once, indexed by an enqueue position that only the producer writes and
+ * a dequeue position that only the consumer writes, so every call finishes in a bounded number of steps without a compare-and-swap.
+ * enqueue_n and dequeue_n move a whole batch for a single update of the position the other thread reads.
+ * Using more than one producer or more than one consumer at a time is undefined; infra_mpmc_queue handles that case. */
+template <class T> class infra_spsc_queue final
+{
+public:
+    // common member types //
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    //---------------------//
+
+    // constructors //
+
+    /**
+     * @brief Constructs an empty WHATWG infra SPSC queue.
+     * @param capacity The most items the queue holds at once, rounded up to a power of two of at least 2. */
+    explicit infra_spsc_queue(const size_type capacity) noexcept;
+    infra_spsc_queue(const infra_spsc_queue& src) = delete;
+    /** @brief Destroys the items left in the queue. Neither thread may use the queue any more. */
+    ~infra_spsc_queue() noexcept;
+
+    //--------------//
+
+    // assignments //
+
+    infra_spsc_queue& operator=(const infra_spsc_queue& src) = delete;
+
+    //-------------//
+
+    // WHATWG queue member functions //
+
+    /** @brief Adds the item to the end of the queue. Returns false, leaving the item as it is, if the queue is full. Producer only. */
+    const bool enqueue(const T& item) noexcept;
+    const bool enqueue(T&& item) noexcept;
+    /** @brief Copies as many of the count items as there is room for to the end of the queue, in order. Returns the number added. Producer only. */
+    const size_type enqueue_n(const T* items, const size_type count) noexcept;
+    /** @brief Removes the item at the start of the queue and returns it, or returns std::nullopt if the queue is empty. Consumer only. */
+    std::optional<T> dequeue() noexcept;
+    /** @brief Removes up to count items from the start of the queue, moving them in order into out. Returns the number removed. Consumer only. */
+    const size_type dequeue_n(T* out, const size_type count) noexcept;
+    /** @brief Returns a copy of the item at the start of the queue without removing it, or std::nullopt if the queue is empty. Consumer only. */
+    std::optional<T> peek() const noexcept;
+
+    const size_type capacity() const noexcept;
+    /** @brief Returns the number of items in the queue, which is only a snapshot while the other thread uses it. */
+    const size_type size() const noexcept;
+    const bool empty() const noexcept;
+
+    //-------------------------------//
+
+private:
+    struct slot
+    {
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    const size_type mask;
+    const std::unique_ptr<slot[]> slots;
+    // each thread keeps its own position and its last read of the other thread's position on one cache line, so that it only
+    // touches the other thread's line when the ring looks full or empty
+    alignas(infra_cache_line_size) std::atomic<size_type> enqueue_position;
+    size_type cached_dequeue_position;
+    alignas(infra_cache_line_size) std::atomic<size_type> dequeue_position;
+    mutable size_type cached_enqueue_position;
+
+    T* item_at(const size_type position) const noexcept;
+    const size_type free_slots(const size_type position, const size_type wanted) noexcept;
+    const size_type filled_slots(const size_type position, const size_type wanted) const noexcept;
+    template <class U> const bool emplace(U&& item) noexcept;
+};
+}
+
+#include "softloq/whatwg/infra/structure/spsc_queue.tpp"
+
+#endif
\ No newline at end of file
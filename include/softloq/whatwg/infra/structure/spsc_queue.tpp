@@ -0,0 +1,132 @@
+/**
+ * @file spsc_queue.tpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Template implementation of the WHATWG infra wait-free single-producer single-consumer queue class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/structure/spsc_queue.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace softloq::whatwg
+{
+// constructors //
+
+template <class T> infra_spsc_queue<T>::infra_spsc_queue(const size_type capacity) noexcept
+: mask{std::bit_ceil(capacity < 2 ? size_type{2} : capacity) - 1}, slots{std::make_unique<slot[]>(mask + 1)},
+  enqueue_position{0}, cached_dequeue_position{0}, dequeue_position{0}, cached_enqueue_position{0}
+{
+}
+template <class T> infra_spsc_queue<T>::~infra_spsc_queue() noexcept
+{
+    const size_type last = enqueue_position.load(std::memory_order_acquire);
+    for (size_type position = dequeue_position.load(std::memory_order_relaxed); position != last; ++position) std::destroy_at(item_at(position));
+}
+
+//--------------//
+
+// WHATWG queue member functions //
+
+template <class T> const bool infra_spsc_queue<T>::enqueue(const T& item) noexcept
+{
+    return emplace(item);
+}
+template <class T> const bool infra_spsc_queue<T>::enqueue(T&& item) noexcept
+{
+    return emplace(std::move(item));
+}
+template <class T> template <class U> const bool infra_spsc_queue<T>::emplace(U&& item) noexcept
+{
+    const size_type position = enqueue_position.load(std::memory_order_relaxed);
+    if (free_slots(position, 1) == 0) return false;
+    std::construct_at(reinterpret_cast<T*>(slots[position & mask].storage), std::forward<U>(item));
+    enqueue_position.store(position + 1, std::memory_order_release);
+    return true;
+}
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::enqueue_n(const T* items, const size_type count) noexcept
+{
+    const size_type position = enqueue_position.load(std::memory_order_relaxed);
+    const size_type added = std::min(count, free_slots(position, count));
+    for (size_type i = 0; i < added; ++i) std::construct_at(reinterpret_cast<T*>(slots[(position + i) & mask].storage), items[i]);
+    // one release publishes the whole batch
+    if (added != 0) enqueue_position.store(position + added, std::memory_order_release);
+    return added;
+}
+template <class T> std::optional<T> infra_spsc_queue<T>::dequeue() noexcept
+{
+    const size_type position = dequeue_position.load(std::memory_order_relaxed);
+    if (filled_slots(position, 1) == 0) return std::nullopt;
+    T* const item = item_at(position);
+    std::optional<T> front{std::move(*item)};
+    std::destroy_at(item);
+    dequeue_position.store(position + 1, std::memory_order_release);
+    return front;
+}
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::dequeue_n(T* out, const size_type count) noexcept
+{
+    const size_type position = dequeue_position.load(std::memory_order_relaxed);
+    const size_type removed = std::min(count, filled_slots(position, count));
+    for (size_type i = 0; i < removed; ++i)
+    {
+        T* const item = item_at(position + i);
+        out[i] = std::move(*item);
+        std::destroy_at(item);
+    }
+    if (removed != 0) dequeue_position.store(position + removed, std::memory_order_release);
+    return removed;
+}
+template <class T> std::optional<T> infra_spsc_queue<T>::peek() const noexcept
+{
+    // only the consumer removes items, so the front item stays put while the consumer copies it
+    const size_type position = dequeue_position.load(std::memory_order_relaxed);
+    return filled_slots(position, 1) == 0 ? std::optional<T>{} : std::optional<T>{*item_at(position)};
+}
+
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::capacity() const noexcept
+{
+    return mask + 1;
+}
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::size() const noexcept
+{
+    const size_type dequeued = dequeue_position.load(std::memory_order_acquire);
+    const size_type enqueued = enqueue_position.load(std::memory_order_acquire);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+template <class T> const bool infra_spsc_queue<T>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+//-------------------------------//
+
+// slot helpers //
+
+template <class T> T* infra_spsc_queue<T>::item_at(const size_type position) const noexcept
+{
+    return std::launder(reinterpret_cast<T*>(slots[position & mask].storage));
+}
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::free_slots(const size_type position, const size_type wanted) noexcept
+{
+    // the cached dequeue position only lags behind, so it undercounts the free slots; it is read again only when it is too few
+    size_type free = mask + 1 - (position - cached_dequeue_position);
+    if (free < wanted)
+    {
+        cached_dequeue_position = dequeue_position.load(std::memory_order_acquire);
+        free = mask + 1 - (position - cached_dequeue_position);
+    }
+    return free;
+}
+template <class T> const infra_spsc_queue<T>::size_type infra_spsc_queue<T>::filled_slots(const size_type position, const size_type wanted) const noexcept
+{
+    size_type filled = cached_enqueue_position - position;
+    if (filled < wanted)
+    {
+        cached_enqueue_position = enqueue_position.load(std::memory_order_acquire);
+        filled = cached_enqueue_position - position;
+    }
+    return filled;
+}
+
+//--------------//
+}
\ No newline at end of file
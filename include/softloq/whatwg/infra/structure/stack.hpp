@@ -10,11 +10,12 @@
 #include "softloq/whatwg/infra/structure/list.hpp"
 
 #include <optional>
+#include <ranges>
 
 namespace softloq::whatwg
 {
 /** @brief WHATWG infra stack data structure class. */
-template <class T> class infra_stack final: public infra_list<T>
+template <class T, class Container = std::deque<T>, class Lock = infra_mutex_lock> class infra_stack final: public infra_list<T, Container, Lock>
 {
 public:
     // constructors //
@@ -61,6 +62,13 @@ public:
     void push(T&& item) noexcept;
     std::optional<T> pop() noexcept;
 
+    /** @brief Calls read with the item at the top of the stack under the lock, without copying it. Returns false if the stack is empty. */
+    const bool peek(const std::function<void (const T& item)>& read) const noexcept;
+    /** @brief Removes the item at the top of the stack and moves it into out. Returns false, leaving out as it is, if the stack is empty. */
+    const bool try_pop(T& out) noexcept;
+    /** @brief Removes items from the top of the stack under one lock, moving them top first into the elements of out until either runs out. Returns the number removed. */
+    template <std::ranges::output_range<T> Range> requires std::ranges::sized_range<Range> const infra_list<T, Container, Lock>::size_type pop_into(Range&& out) noexcept;
+
     //------------------//
 };
 }
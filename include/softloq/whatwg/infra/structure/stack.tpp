@@ -6,37 +6,70 @@
 
 #include "softloq/whatwg/infra/structure/stack.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace softloq::whatwg
 {
 // constructors //
 
-template <class T> infra_stack<T>::infra_stack() noexcept {}
-template <class T> infra_stack<T>::infra_stack(const std::initializer_list<T>& values) noexcept : infra_list<T>{values} {}
-template <class T> infra_stack<T>::infra_stack(const infra_stack& src) noexcept : infra_list<T>{src.values} {}
-template <class T> infra_stack<T>::infra_stack(infra_stack&& src) noexcept : infra_list<T>{std::move(src)} {}
-template <class T> infra_stack<T>::~infra_stack() noexcept {}
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>::infra_stack() noexcept {}
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>::infra_stack(const std::initializer_list<T>& values) noexcept : infra_list<T, Container, Lock>{values} {}
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>::infra_stack(const infra_stack& src) noexcept : infra_list<T, Container, Lock>{src} {}
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>::infra_stack(infra_stack&& src) noexcept : infra_list<T, Container, Lock>{std::move(src)} {}
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>::~infra_stack() noexcept {}
 
 //--------------//
 
 // assignments //
 
-template <class T> infra_stack<T>& infra_stack<T>::operator=(const infra_stack& src) noexcept { infra_list<T>::values = src.values; return *this; }
-template <class T> infra_stack<T>& infra_stack<T>::operator=(infra_stack&& src) noexcept { infra_list<T>::values = std::move(src.values); return *this; }
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>& infra_stack<T, Container, Lock>::operator=(const infra_stack& src) noexcept { infra_list<T, Container, Lock>::operator=(src); return *this; }
+template <class T, class Container, class Lock> infra_stack<T, Container, Lock>& infra_stack<T, Container, Lock>::operator=(infra_stack&& src) noexcept { infra_list<T, Container, Lock>::operator=(std::move(src)); return *this; }
 
 //-------------//
 
 // WHATWG stack member functions //
 
-template <class T> std::optional<T> infra_stack<T>::peek() const noexcept { return infra_list<T>::empty() ? std::optional<T>{} : infra_list<T>::back(); }
-template <class T> void infra_stack<T>::push(const T& item) noexcept { infra_list<T>::push_back(T); }
-template <class T> void infra_stack<T>::push(T&& item) noexcept { infra_list<T>::push_back(std::move(T)); }
-template <class T> std::optional<T> infra_stack<T>::pop() noexcept
+template <class T, class Container, class Lock> std::optional<T> infra_stack<T, Container, Lock>::peek() const noexcept
+{
+    // checked and read under one lock, so that no other thread pops the item in between
+    typename infra_list<T, Container, Lock>::read_lock lock(this->mtx);
+    return this->data.empty() ? std::optional<T>{} : this->data.back();
+}
+template <class T, class Container, class Lock> void infra_stack<T, Container, Lock>::push(const T& item) noexcept { infra_list<T, Container, Lock>::append(item); }
+template <class T, class Container, class Lock> void infra_stack<T, Container, Lock>::push(T&& item) noexcept { infra_list<T, Container, Lock>::append(std::move(item)); }
+template <class T, class Container, class Lock> std::optional<T> infra_stack<T, Container, Lock>::pop() noexcept
 {
-    if (infra_list<T>::empty()) return std::optional<T>{};
-    std::optional<T> back = infra_list<T>::back();
-    infra_list<T>::pop_back();
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    if (this->data.empty()) return std::optional<T>{};
+    std::optional<T> back{std::move(this->data.back())};
+    this->data.pop_back();
     return back;
 }
 
+template <class T, class Container, class Lock> const bool infra_stack<T, Container, Lock>::peek(const std::function<void (const T& item)>& read) const noexcept
+{
+    typename infra_list<T, Container, Lock>::read_lock lock(this->mtx);
+    if (this->data.empty()) return false;
+    read(this->data.back());
+    return true;
+}
+template <class T, class Container, class Lock> const bool infra_stack<T, Container, Lock>::try_pop(T& out) noexcept
+{
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    if (this->data.empty()) return false;
+    out = std::move(this->data.back());
+    this->data.pop_back();
+    return true;
+}
+template <class T, class Container, class Lock> template <std::ranges::output_range<T> Range> requires std::ranges::sized_range<Range> const infra_list<T, Container, Lock>::size_type infra_stack<T, Container, Lock>::pop_into(Range&& out) noexcept
+{
+    typename infra_list<T, Container, Lock>::write_lock lock(this->mtx);
+    const auto count = std::min(static_cast<typename infra_list<T, Container, Lock>::size_type>(std::ranges::size(out)), static_cast<typename infra_list<T, Container, Lock>::size_type>(this->data.size()));
+    std::move(this->data.rbegin(), std::next(this->data.rbegin(), count), std::ranges::begin(out));
+    this->data.erase(std::prev(this->data.end(), count), this->data.end());
+    return count;
+}
+
 //------------------//
 }
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * @file document.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra JSON document class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/json/document.hpp"
+#include "parser.hpp"
+
+namespace softloq::whatwg
+{
+// arena //
+
+namespace
+{
+/** @brief Counts what a document takes from the default resource once its block runs out. */
+class overflow_resource final : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocated = 0;
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        allocated += bytes;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+}
+/** @brief A monotonic buffer over one block that is regrown, after a parse that overflowed it, to hold everything that parse took. */
+struct infra_json_document::arena_resource
+{
+    std::unique_ptr<std::byte[]> block;
+    std::size_t size = 0;
+    overflow_resource overflow;
+    std::pmr::monotonic_buffer_resource buffer{&overflow};
+
+    std::pmr::memory_resource* reset() noexcept
+    {
+        buffer.release();
+        if (overflow.allocated)
+        {
+            size += overflow.allocated;
+            overflow.allocated = 0;
+            block = std::make_unique_for_overwrite<std::byte[]>(size);
+            // a monotonic buffer cannot be given a new block, so it is made again over the grown one
+            std::destroy_at(&buffer);
+            std::construct_at(&buffer, block.get(), size, &overflow);
+        }
+        return &buffer;
+    }
+};
+
+//-------//
+
+// constructors //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_document::infra_json_document() noexcept
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_document::infra_json_document(infra_json_document&& src) noexcept
+: arena{std::move(src.arena)}, value{std::move(src.value)}
+{
+    src.value = infra_json_value{};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_document::~infra_json_document() noexcept
+{
+}
+
+//--------------//
+
+// assignments //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_document& infra_json_document::operator=(infra_json_document&& src) noexcept
+{
+    if (this == &src) return *this;
+    // the old root goes before the arena it lives in
+    value = infra_json_value{};
+    arena = std::move(src.arena);
+    // moving a list or map keeps its memory resource, so the root stays in the arena it was parsed into
+    value = std::move(src.value);
+    src.value = infra_json_value{};
+    return *this;
+}
+
+//-------------//
+
+// WHATWG JSON document member functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_document::parse(const infra_byte_sequence& bytes) noexcept
+{
+    return json::parse(bytes, reset(), value);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_document::parse(const std::string& bytes) noexcept
+{
+    return json::parse(bytes, reset(), value);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_document::parse(const infra_string& string) noexcept
+{
+    return json::parse(string, reset(), value);
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_json_value& infra_json_document::root() const noexcept
+{
+    return value;
+}
+std::pmr::memory_resource* infra_json_document::reset() noexcept
+{
+    value = infra_json_value{};
+    if (!arena) arena = std::make_unique<arena_resource>();
+    return arena->reset();
+}
+
+//---------------------------------------//
+}
\ No newline at end of file
@@ -0,0 +1,388 @@
+/**
+ * @file lazy.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra JSON lazy document and value classes.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/json/lazy.hpp"
+#include "parser.hpp"
+#include "../primitive/kernel.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace softloq::whatwg
+{
+// WHATWG JSON lazy value iterator //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator::const_iterator() noexcept
+: document{nullptr}, index{0}, map{false}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator::const_iterator(const infra_json_lazy_document* document, const std::uint32_t index, const bool map) noexcept
+: document{document}, index{index}, map{map}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value infra_json_lazy_value::const_iterator::operator*() const noexcept
+{
+    return infra_json_lazy_value{document, map ? index + 1 : index};
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_string> infra_json_lazy_value::const_iterator::key() const noexcept
+{
+    if (!map) return std::nullopt;
+    return infra_json_lazy_value{document, index}.as_string();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator& infra_json_lazy_value::const_iterator::operator++() noexcept
+{
+    // a map entry is its key followed by its value
+    index = document->tape[map ? index + 1 : index].next;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator infra_json_lazy_value::const_iterator::operator++(int) noexcept
+{
+    const_iterator it{*this};
+    ++*this;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::const_iterator::operator==(const const_iterator& b) const noexcept
+{
+    return document == b.document && index == b.index;
+}
+
+//---------------------------------//
+
+// WHATWG JSON lazy value member functions //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::infra_json_lazy_value(const infra_json_lazy_document* document, const std::uint32_t index) noexcept
+: document{document}, index{index}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* infra_json_lazy_value::text() const noexcept
+{
+    return document->bytes() + document->tape[index].offset;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_json_type infra_json_lazy_value::type() const noexcept
+{
+    // the document only accepts tokens whose first byte starts a value, so it tells the type
+    switch (*text())
+    {
+    case '"': return infra_json_type::infra_string;
+    case '[': return infra_json_type::infra_list;
+    case '{': return infra_json_type::infra_map;
+    case 't': case 'f': return infra_json_type::infra_bool;
+    case 'n': return infra_json_type::infra_null;
+    default: return infra_json_type::infra_number;
+    }
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_null() const noexcept
+{
+    return type() == infra_json_type::infra_null;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_bool() const noexcept
+{
+    return type() == infra_json_type::infra_bool;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_number() const noexcept
+{
+    return type() == infra_json_type::infra_number;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_string() const noexcept
+{
+    return type() == infra_json_type::infra_string;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_list() const noexcept
+{
+    return type() == infra_json_type::infra_list;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_value::is_map() const noexcept
+{
+    return type() == infra_json_type::infra_map;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<bool> infra_json_lazy_value::as_bool() const noexcept
+{
+    const std::uint8_t* const p = text();
+    const std::uint8_t* const end = document->bytes() + document->text.size();
+    if (*p == 't' && json::parse_literal(p, end, "true", 4)) return true;
+    if (*p == 'f' && json::parse_literal(p, end, "false", 5)) return false;
+    return std::nullopt;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<double> infra_json_lazy_value::as_number() const noexcept
+{
+    double number;
+    if (!is_number() || !json::parse_number(text(), document->bytes() + document->text.size(), number)) return std::nullopt;
+    return number;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_string> infra_json_lazy_value::as_string() const noexcept
+{
+    infra_string string;
+    if (!is_string() || !json::parse_string(text(), document->bytes() + document->text.size(), string)) return std::nullopt;
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API const std::size_t infra_json_lazy_value::size() const noexcept
+{
+    std::size_t size = 0;
+    for (const_iterator it = begin(), last = end(); it != last; ++it) ++size;
+    return size;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_lazy_value> infra_json_lazy_value::at(std::size_t index) const noexcept
+{
+    if (!is_list()) return std::nullopt;
+    for (const_iterator it = begin(), last = end(); it != last; ++it)
+        if (!index--) return *it;
+    return std::nullopt;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_lazy_value> infra_json_lazy_value::find(const infra_string_view& key) const noexcept
+{
+    if (!is_map()) return std::nullopt;
+    // raw keys are compared to the UTF-8 of the key, which is only exact when the key needs no escaping and has no lone surrogate
+    std::unique_ptr<std::uint8_t[]> encoded = std::make_unique_for_overwrite<std::uint8_t[]>(key.byte_encoding_size() + 1);
+    const std::size_t size = key.byte_encoding(encoded.get());
+    const auto units = key.code_units();
+    const bool raw = kernel::find_json_special(encoded.get(), size) == size
+                  && (!units.is_wide() || kernel::is_scalar(units.utf16_data(), units.size()));
+
+    const std::uint8_t* const text_end = document->bytes() + document->text.size();
+    std::optional<infra_json_lazy_value> found;
+    for (const_iterator it = begin(), last = end(); it != last; ++it)
+    {
+        const std::uint8_t* const quote = document->bytes() + document->tape[it.index].offset;
+        const std::uint8_t* const chars = quote + 1;
+        const std::size_t room = text_end - chars;
+        if (raw)
+        {
+            if (room > size && chars[size] == '"' && !std::memcmp(chars, encoded.get(), size))
+            {
+                found = *it;
+                continue;
+            }
+            // only a key with an escape, or with bytes that may be invalid UTF-8 and so decode to U+FFFD, can still be equal
+            const std::size_t special = kernel::find_json_special(chars, room);
+            if (special == room) continue;
+            if (chars[special] != '\\' && (chars[special] != '"' || kernel::is_ascii(chars, special))) continue;
+        }
+        infra_string string;
+        if (json::parse_string(quote, text_end, string) && infra_string_view{string} == key) found = *it;
+    }
+    return found;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator infra_json_lazy_value::begin() const noexcept
+{
+    const std::uint8_t c = *text();
+    if (c != '[' && c != '{') return end();
+    return const_iterator{document, index + 1, c == '{'};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value::const_iterator infra_json_lazy_value::end() const noexcept
+{
+    const std::uint8_t c = *text();
+    // the entry before the one after a list or map is its closing bracket
+    if (c != '[' && c != '{') return const_iterator{document, index, false};
+    return const_iterator{document, document->tape[index].next - 1, c == '{'};
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_value> infra_json_lazy_value::materialize() const noexcept
+{
+    switch (type())
+    {
+    case infra_json_type::infra_null:
+        if (!json::parse_literal(text(), document->bytes() + document->text.size(), "null", 4)) return std::nullopt;
+        return infra_json_value{};
+    case infra_json_type::infra_bool:
+        if (const auto value = as_bool()) return infra_json_value{*value};
+        return std::nullopt;
+    case infra_json_type::infra_number:
+        if (const auto value = as_number()) return infra_json_value{*value};
+        return std::nullopt;
+    case infra_json_type::infra_string:
+        if (auto value = as_string()) return infra_json_value{std::move(*value)};
+        return std::nullopt;
+    default:
+    {
+        const std::uint32_t first = document->tape[index].offset;
+        const std::uint32_t last = document->tape[document->tape[index].next - 1].offset;
+        infra_json_value value;
+        if (!json::parse(document->bytes() + first, last - first + 1, std::pmr::get_default_resource(), value)) return std::nullopt;
+        return value;
+    }
+    }
+}
+
+//-----------------------------------------//
+
+// constructors //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document::infra_json_lazy_document() noexcept
+{
+    reset();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document::infra_json_lazy_document(infra_json_lazy_document&& src) noexcept
+: text{std::move(src.text)}, tape{std::move(src.tape)}, tape_capacity{src.tape_capacity}
+{
+    src.tape_capacity = 0;
+    src.reset();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document::~infra_json_lazy_document() noexcept
+{
+}
+
+//--------------//
+
+// assignments //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_document& infra_json_lazy_document::operator=(infra_json_lazy_document&& src) noexcept
+{
+    if (this == &src) return *this;
+    text = std::move(src.text);
+    tape = std::move(src.tape);
+    tape_capacity = src.tape_capacity;
+    src.tape_capacity = 0;
+    src.reset();
+    return *this;
+}
+
+//-------------//
+
+// WHATWG JSON lazy document member functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_document::parse(const infra_byte_sequence& bytes) noexcept
+{
+    // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+    const std::string_view view{reinterpret_cast<const char*>(std::to_address(bytes.cbegin())), bytes.size()};
+    text.assign(view.substr(view.starts_with("\xEF\xBB\xBF") ? 3 : 0));
+    return index();
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_document::parse(const std::string& bytes) noexcept
+{
+    const std::string_view view{bytes};
+    text.assign(view.substr(view.starts_with("\xEF\xBB\xBF") ? 3 : 0));
+    return index();
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_document::parse(std::string&& bytes) noexcept
+{
+    text = std::move(bytes);
+    if (text.starts_with("\xEF\xBB\xBF")) text.erase(0, 3);
+    return index();
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_document::parse(const infra_string& string) noexcept
+{
+    text.resize(string.byte_encoding_size());
+    text.resize(string.byte_encoding(reinterpret_cast<std::uint8_t*>(text.data())));
+    return index();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_lazy_value infra_json_lazy_document::root() const noexcept
+{
+    return infra_json_lazy_value{this, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* infra_json_lazy_document::bytes() const noexcept
+{
+    return reinterpret_cast<const std::uint8_t*>(text.data());
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_lazy_document::index() noexcept
+{
+    std::size_t size = 0;
+    const std::uint32_t* index = json::structural_index(bytes(), text.size(), size);
+    if (!index)
+    {
+        json::release_scratch();
+        reset();
+        return false;
+    }
+    // the tape never has more entries than there are structural bytes
+    if (tape_capacity < size)
+    {
+        tape = std::make_unique_for_overwrite<tape_entry[]>(size);
+        tape_capacity = size;
+    }
+    const std::uint32_t* const last = index + size;
+    const std::uint8_t* const bytes = this->bytes();
+    tape_entry* const entries = tape.get();
+    std::uint32_t position = 0;
+    std::vector<std::uint32_t> open;
+
+    enum class expect { value, key, next };
+    expect state = expect::value;
+    const bool indexed = [&]
+    {
+        while (true)
+        {
+            switch (state)
+            {
+            case expect::value:
+            {
+                if (index == last) return false;
+                const std::uint32_t offset = *index++;
+                const std::uint8_t c = bytes[offset];
+                entries[position] = {offset, position + 1};
+                if (c == '[' || c == '{')
+                {
+                    if (open.size() == json::max_depth) return false;
+                    // ] and } are two past [ and {
+                    if (index != last && bytes[*index] == c + 2)
+                    {
+                        entries[position + 1] = {*index++, position + 2};
+                        entries[position].next = position + 2;
+                        position += 2;
+                        state = expect::next;
+                    }
+                    else
+                    {
+                        open.push_back(position++);
+                        state = c == '[' ? expect::value : expect::key;
+                    }
+                }
+                else if (c == '"' || c == 't' || c == 'f' || c == 'n' || c == '-' || (c >= '0' && c <= '9'))
+                {
+                    ++position;
+                    state = expect::next;
+                }
+                else return false;
+                break;
+            }
+            case expect::key:
+            {
+                if (index == last || bytes[*index] != '"') return false;
+                entries[position] = {*index++, position + 1};
+                ++position;
+                if (index == last || bytes[*index] != ':') return false;
+                ++index;
+                state = expect::value;
+                break;
+            }
+            case expect::next:
+            {
+                if (open.empty()) return index == last;
+                if (index == last) return false;
+                const std::uint32_t offset = *index++;
+                const std::uint8_t c = bytes[offset];
+                const std::uint32_t container = open.back();
+                const bool map = bytes[entries[container].offset] == '{';
+                if (c == ',') state = map ? expect::key : expect::value;
+                else if (c == (map ? '}' : ']'))
+                {
+                    entries[position] = {offset, position + 1};
+                    entries[container].next = ++position;
+                    open.pop_back();
+                }
+                else return false;
+                break;
+            }
+            }
+        }
+    }();
+    // the tape holds everything read from the index, so a large index of the thread can go
+    json::release_scratch();
+    if (!indexed) reset();
+    return indexed;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_lazy_document::reset() noexcept
+{
+    text = "null";
+    if (!tape_capacity)
+    {
+        tape = std::make_unique_for_overwrite<tape_entry[]>(1);
+        tape_capacity = 1;
+    }
+    tape[0] = {0, 1};
+}
+
+//--------------------------------------------//
+}
\ No newline at end of file
@@ -0,0 +1,518 @@
+/**
+ * @file parser.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the JSON parser used by the WHATWG infra JSON classes.
+ * @version 1.0.0 */
+
+#include "parser.hpp"
+#include "../primitive/kernel.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace softloq::whatwg::json
+{
+namespace
+{
+// scratch buffers //
+
+/** @brief An open list or map, filled in place, with the position its key hashes start at. */
+struct frame
+{
+    infra_json_value::list_type* list;
+    infra_json_value::map_type* map;
+    std::size_t hashes;
+};
+/**
+ * @brief Buffers reused by every parse on a thread, so that parsing many small texts does not allocate them each time.
+ * A buffer that a large text grew past scratch_limit bytes is freed once the parse is done, so that it is not held for the life of the thread. */
+struct scratch_buffers
+{
+    std::unique_ptr<std::uint32_t[]> indexes;
+    std::size_t index_capacity = 0;
+    std::vector<std::uint8_t> text;
+    std::vector<std::uint16_t> units;
+    std::vector<std::uint32_t> sizes;
+    std::vector<std::size_t> open;
+    std::vector<std::uint64_t> key_hashes;
+    std::vector<std::pair<std::uint64_t, std::size_t>> sorted_keys;
+    std::vector<frame> frames;
+};
+thread_local scratch_buffers scratch;
+constexpr std::size_t scratch_limit = std::size_t{1} << 20;
+/** @brief Bytes of text indexed per call of the kernel, so that the index grows with the structural bytes found rather than with the text. */
+constexpr std::size_t index_chunk = std::size_t{1} << 16;
+
+template <typename item_type>
+inline void release_if_large(std::vector<item_type>& buffer) noexcept
+{
+    if (buffer.capacity() * sizeof(item_type) > scratch_limit) std::vector<item_type>{}.swap(buffer);
+}
+
+//-----------------//
+
+// token readers //
+
+/** @brief Every power of ten that a double holds exactly. A double also holds every integer up to 2^53 exactly. */
+constexpr double exact_powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline const bool is_digit(const std::uint8_t c) noexcept
+{
+    return static_cast<unsigned>(c - 0x30) < 10;
+}
+inline const int hex_value(const std::uint8_t c) noexcept
+{
+    if (is_digit(c)) return c - 0x30;
+    const std::uint8_t lower = c | 0x20;
+    return lower >= 0x61 && lower <= 0x66 ? lower - 0x61 + 10 : -1;
+}
+/** @brief Checks that a number or literal ends at p: at the end of the text, at an operator, or at whitespace. */
+inline const bool ends_token(const std::uint8_t* p, const std::uint8_t* end) noexcept
+{
+    if (p == end) return true;
+    switch (*p)
+    {
+    case 0x09: case 0x0A: case 0x0D: case 0x20:
+    case 0x2C: case 0x3A: case 0x5B: case 0x5D: case 0x7B: case 0x7D: return true;
+    default: return false;
+    }
+}
+template <typename unit_type>
+inline const std::uint64_t hash_units(const unit_type* units, const std::size_t count) noexcept
+{
+    std::uint64_t hash = 0xCBF29CE484222325;
+    for (std::size_t i = 0; i < count; ++i) hash = (hash ^ units[i]) * 0x100000001B3;
+    return hash;
+}
+void append_utf8(std::vector<std::uint16_t>& units, const std::uint8_t* bytes, const std::size_t count) noexcept
+{
+    const std::size_t size = units.size();
+    units.resize(size + count);
+    units.resize(size + kernel::utf8_decode(bytes, units.data() + size, count));
+}
+/**
+ * @brief Reads the string whose opening quote is at p. The plain runs between escapes are found by a vectorized scan, and ASCII without escapes
+ * is copied as it is. Hashes the code units when asked, so that map keys can be checked for repeats. Returns false on an unknown escape,
+ * an unescaped control character, or a missing closing quote. */
+const bool read_string(const std::uint8_t* p, const std::uint8_t* end, std::vector<std::uint16_t>& units, infra_string& string, std::uint64_t* hash) noexcept
+{
+    const std::uint8_t* run = ++p;
+    bool escaped = false;
+    units.clear();
+    for (;;)
+    {
+        p += kernel::find_json_special(p, end - p);
+        if (p == end || *p < 0x20) return false;
+        if (*p == 0x22) break;
+        append_utf8(units, run, p - run);
+        escaped = true;
+        if (++p == end) return false;
+        switch (*p)
+        {
+        case 0x22: case 0x2F: case 0x5C: units.push_back(*p); break;
+        case 0x62: units.push_back(0x08); break;
+        case 0x66: units.push_back(0x0C); break;
+        case 0x6E: units.push_back(0x0A); break;
+        case 0x72: units.push_back(0x0D); break;
+        case 0x74: units.push_back(0x09); break;
+        case 0x75:
+        {
+            // surrogates stay code units, so an escaped pair joins up by itself
+            if (end - p < 5) return false;
+            std::uint16_t unit = 0;
+            for (int i = 1; i <= 4; ++i)
+            {
+                const int digit = hex_value(p[i]);
+                if (digit < 0) return false;
+                unit = static_cast<std::uint16_t>(unit << 4 | digit);
+            }
+            units.push_back(unit);
+            p += 4;
+            break;
+        }
+        default: return false;
+        }
+        run = ++p;
+    }
+    const std::size_t count = p - run;
+    if (!escaped && kernel::is_ascii(run, count))
+    {
+        string = infra_string{infra_string_view{run, count}};
+        if (hash) *hash = hash_units(run, count);
+        return true;
+    }
+    append_utf8(units, run, count);
+    string = infra_string{infra_string_view{units.data(), units.size()}};
+    if (hash) *hash = hash_units(units.data(), units.size());
+    return true;
+}
+/**
+ * @brief Reads the number that starts at p. Up to 19 significant digits with an exponent within the exact powers of ten are converted with one
+ * multiplication or division, which is exact; anything else goes through std::from_chars. */
+const bool read_number(const std::uint8_t* p, const std::uint8_t* end, double& number) noexcept
+{
+    const bool negative = *p == 0x2D;
+    if (negative) ++p;
+    const std::uint8_t* const start = p;
+    if (p == end || !is_digit(*p)) return false;
+    std::uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool truncated = false;
+    if (*p == 0x30) ++p;
+    else for (; p != end && is_digit(*p); ++p)
+    {
+        if (digits < 19) mantissa = mantissa * 10 + (*p - 0x30), ++digits;
+        else truncated = true, ++exponent;
+    }
+    if (p != end && *p == 0x2E)
+    {
+        if (++p == end || !is_digit(*p)) return false;
+        for (; p != end && is_digit(*p); ++p)
+        {
+            if (!mantissa && *p == 0x30) --exponent;
+            else if (digits < 19) mantissa = mantissa * 10 + (*p - 0x30), ++digits, --exponent;
+            else truncated = true;
+        }
+    }
+    if (p != end && (*p | 0x20) == 0x65)
+    {
+        if (++p == end) return false;
+        const bool negative_exponent = *p == 0x2D;
+        if (*p == 0x2B || *p == 0x2D) ++p;
+        if (p == end || !is_digit(*p)) return false;
+        int value = 0;
+        for (; p != end && is_digit(*p); ++p) if (value < 100000) value = value * 10 + (*p - 0x30);
+        exponent += negative_exponent ? -value : value;
+    }
+    if (!ends_token(p, end)) return false;
+    if (!mantissa) number = 0;
+    else if (!truncated && mantissa <= std::uint64_t{1} << 53 && exponent >= -22 && exponent <= 22)
+    {
+        const double value = static_cast<double>(mantissa);
+        number = exponent < 0 ? value / exact_powers[-exponent] : value * exact_powers[exponent];
+    }
+    else if (std::from_chars(reinterpret_cast<const char*>(start), reinterpret_cast<const char*>(p), number).ec == std::errc::result_out_of_range)
+    {
+        // the decimal point is exponent + digits places after the first significant digit, so a positive distance overflows and a negative one underflows
+        number = exponent + digits > 0 ? std::numeric_limits<double>::infinity() : 0;
+    }
+    if (negative) number = -number;
+    return true;
+}
+inline const bool read_literal(const std::uint8_t* p, const std::uint8_t* end, const char* literal, const std::size_t size) noexcept
+{
+    return static_cast<std::size_t>(end - p) >= size && !std::memcmp(p, literal, size) && ends_token(p + size, end);
+}
+
+//---------------//
+
+// containers //
+
+/**
+ * @brief Merges repeated keys the way JSON.parse does: the first entry keeps its place and takes the value of the last one.
+ * Repeats are rare, so the key hashes are checked first. The entries are then sorted by hash and position, so that each key is only
+ * compared with the first entries of the other keys that share its hash, which keeps the merge O(n log n) however many keys repeat. */
+void merge_repeated_keys(infra_json_value::map_type& map, const std::uint64_t* hashes) noexcept
+{
+    const std::size_t size = map.size();
+    std::vector<std::pair<std::uint64_t, std::size_t>>& sorted = scratch.sorted_keys;
+    const auto sort_keys = [&]() noexcept
+    {
+        sorted.clear();
+        for (std::size_t i = 0; i < size; ++i) sorted.emplace_back(hashes[i], i);
+        std::sort(sorted.begin(), sorted.end());
+    };
+    if (size <= 16)
+    {
+        bool repeated = false;
+        for (std::size_t i = 1; i < size && !repeated; ++i) for (std::size_t j = 0; j < i; ++j) if (hashes[i] == hashes[j]) { repeated = true; break; }
+        if (!repeated) return;
+        sort_keys();
+    }
+    else
+    {
+        sort_keys();
+        const auto same_hash = [](const auto& a, const auto& b) noexcept { return a.first == b.first; };
+        if (std::adjacent_find(sorted.begin(), sorted.end(), same_hash) == sorted.end()) return;
+    }
+    std::vector<bool> merged(size);
+    for (std::size_t run = 0; run < size;)
+    {
+        std::size_t run_end = run + 1;
+        while (run_end < size && sorted[run_end].first == sorted[run].first) ++run_end;
+        // the first entry of each distinct key in the run is moved to the front of it, in position order
+        std::size_t firsts = run + 1;
+        for (std::size_t k = run + 1; k < run_end; ++k)
+        {
+            const std::size_t i = sorted[k].second;
+            std::size_t first = run;
+            while (first < firsts && !(map[sorted[first].second].first == map[i].first)) ++first;
+            if (first == firsts) sorted[firsts++] = sorted[k];
+            else
+            {
+                map[sorted[first].second].second = std::move(map[i].second);
+                merged[i] = true;
+            }
+        }
+        run = run_end;
+    }
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < size; ++i) if (!merged[i]) { if (kept != i) map[kept] = std::move(map[i]); ++kept; }
+    map.erase(map.begin() + kept, map.end());
+}
+/**
+ * @brief Counts the values of every list and map, in the order they open, so that each can be reserved exactly and filled in place.
+ * The counts of text that is not JSON may be wrong, which filling a container past its count reports. */
+void count_values(const std::uint8_t* text, const std::uint32_t* index, const std::uint32_t* last, std::vector<std::uint32_t>& sizes, std::vector<std::size_t>& open) noexcept
+{
+    std::uint8_t previous = 0;
+    for (; index != last; ++index)
+    {
+        const std::uint8_t c = text[*index];
+        switch (c)
+        {
+        case 0x5B: case 0x7B:
+            open.push_back(sizes.size());
+            sizes.push_back(0);
+            break;
+        case 0x2C:
+            if (!open.empty()) ++sizes[open.back()];
+            break;
+        case 0x5D: case 0x7D:
+            if (open.empty()) break;
+            if (previous != 0x5B && previous != 0x7B) ++sizes[open.back()];
+            open.pop_back();
+            break;
+        }
+        previous = c;
+    }
+}
+
+//------------//
+
+// parsing //
+
+/**
+ * @brief Reads the tokens in the order of the structural index, constructing each value once in the list or map it belongs to.
+ * Lists and maps are reserved to their counted size, so the open ones never move while their values are filled in. */
+const bool read_tokens(const std::uint8_t* text, const std::size_t count, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    scratch_buffers& buffers = scratch;
+    std::size_t size = 0;
+    const std::uint32_t* index = structural_index(text, count, size);
+    if (!index) return false;
+    const std::uint32_t* const last = index + size;
+    const std::uint8_t* const end = text + count;
+    count_values(text, index, last, buffers.sizes, buffers.open);
+    const std::uint32_t* sizes = buffers.sizes.data();
+    std::vector<frame>& frames = buffers.frames;
+    infra_string key;
+    // places a value in the open list or map, or at the root; returns nullptr if the container is already full, which only text that is not JSON does
+    const auto place = [&](auto&& made) noexcept -> infra_json_value*
+    {
+        if (frames.empty())
+        {
+            value = std::move(made);
+            return &value;
+        }
+        const frame& top = frames.back();
+        if (top.list)
+        {
+            if (top.list->size() == top.list->capacity()) return nullptr;
+            return &top.list->emplace_back(std::move(made));
+        }
+        if (top.map->size() == top.map->capacity()) return nullptr;
+        return &top.map->emplace_back(std::move(key), std::move(made)).second;
+    };
+    enum class expect { value, key, next } state = expect::value;
+    for (;;)
+    {
+        switch (state)
+        {
+        case expect::value:
+        {
+            if (index == last) return false;
+            const std::uint8_t* p = text + *index++;
+            infra_json_value* placed = nullptr;
+            state = expect::next;
+            switch (*p)
+            {
+            case 0x5B:
+            {
+                if (frames.size() == max_depth || !(placed = place(infra_json_value::list_type(resource)))) return false;
+                infra_json_value::list_type& list = placed->as_list();
+                list.reserve(*sizes++);
+                if (index != last && text[*index] == 0x5D) ++index;
+                else frames.push_back(frame{&list, nullptr, 0}), state = expect::value;
+                continue;
+            }
+            case 0x7B:
+            {
+                if (frames.size() == max_depth || !(placed = place(infra_json_value::map_type(resource)))) return false;
+                infra_json_value::map_type& map = placed->as_map();
+                map.reserve(*sizes++);
+                if (index != last && text[*index] == 0x7D) ++index;
+                else frames.push_back(frame{nullptr, &map, buffers.key_hashes.size()}), state = expect::key;
+                continue;
+            }
+            case 0x22:
+            {
+                infra_string string;
+                if (!read_string(p, end, buffers.units, string, nullptr)) return false;
+                placed = place(std::move(string));
+                break;
+            }
+            case 0x74:
+                if (!read_literal(p, end, "true", 4)) return false;
+                placed = place(true);
+                break;
+            case 0x66:
+                if (!read_literal(p, end, "false", 5)) return false;
+                placed = place(false);
+                break;
+            case 0x6E:
+                if (!read_literal(p, end, "null", 4)) return false;
+                placed = place(infra_null{});
+                break;
+            default:
+            {
+                double number;
+                if (!read_number(p, end, number)) return false;
+                placed = place(number);
+            }
+            }
+            if (!placed) return false;
+            break;
+        }
+        case expect::key:
+        {
+            if (index == last || text[*index] != 0x22) return false;
+            std::uint64_t hash;
+            if (!read_string(text + *index++, end, buffers.units, key, &hash)) return false;
+            buffers.key_hashes.push_back(hash);
+            if (index == last || text[*index] != 0x3A) return false;
+            ++index;
+            state = expect::value;
+            break;
+        }
+        case expect::next:
+        {
+            if (frames.empty()) return index == last;
+            if (index == last) return false;
+            const frame& top = frames.back();
+            const std::uint8_t c = text[*index++];
+            if (c == 0x2C)
+            {
+                state = top.map ? expect::key : expect::value;
+                break;
+            }
+            if (c != (top.map ? 0x7D : 0x5D)) return false;
+            if (top.map)
+            {
+                merge_repeated_keys(*top.map, buffers.key_hashes.data() + top.hashes);
+                buffers.key_hashes.resize(top.hashes);
+            }
+            frames.pop_back();
+            break;
+        }
+        }
+    }
+}
+const bool parse_text(const std::uint8_t* text, const std::size_t count, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    const bool parsed = read_tokens(text, count, resource, value);
+    if (!parsed) value = infra_json_value{};
+    scratch.sizes.clear();
+    scratch.open.clear();
+    scratch.key_hashes.clear();
+    scratch.frames.clear();
+    release_scratch();
+    return parsed;
+}
+const bool parse_bytes(const std::uint8_t* bytes, std::size_t count, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    if (count >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF) bytes += 3, count -= 3;
+    return parse_text(bytes, count, resource, value);
+}
+
+//---------//
+}
+
+const std::uint32_t* structural_index(const std::uint8_t* text, const std::size_t count, std::size_t& size) noexcept
+{
+    scratch_buffers& buffers = scratch;
+    if (count >= std::numeric_limits<std::uint32_t>::max()) return nullptr;
+    std::uint64_t escaped = 0, in_string = 0, after_scalar = 0;
+    size = 0;
+    std::size_t offset = 0;
+    do
+    {
+        const std::size_t length = std::min(index_chunk, count - offset);
+        if (!buffers.indexes || buffers.index_capacity - size < length)
+        {
+            const std::size_t capacity = std::max(size + length, buffers.index_capacity * 2);
+            std::unique_ptr<std::uint32_t[]> indexes = std::make_unique_for_overwrite<std::uint32_t[]>(capacity);
+            if (size) std::memcpy(indexes.get(), buffers.indexes.get(), size * sizeof(std::uint32_t));
+            buffers.indexes = std::move(indexes);
+            buffers.index_capacity = capacity;
+        }
+        kernel::json_structural_index(text + offset, length, offset, buffers.indexes.get(), size, escaped, in_string, after_scalar);
+        offset += length;
+    } while (offset < count);
+    return in_string ? nullptr : buffers.indexes.get();
+}
+void release_scratch() noexcept
+{
+    scratch_buffers& buffers = scratch;
+    if (buffers.index_capacity * sizeof(std::uint32_t) > scratch_limit)
+    {
+        buffers.indexes.reset();
+        buffers.index_capacity = 0;
+    }
+    release_if_large(buffers.text);
+    release_if_large(buffers.units);
+    release_if_large(buffers.sizes);
+    release_if_large(buffers.open);
+    release_if_large(buffers.key_hashes);
+    release_if_large(buffers.sorted_keys);
+    release_if_large(buffers.frames);
+}
+const bool parse_string(const std::uint8_t* quote, const std::uint8_t* end, infra_string& string) noexcept
+{
+    return read_string(quote, end, scratch.units, string, nullptr);
+}
+const bool parse_number(const std::uint8_t* p, const std::uint8_t* end, double& number) noexcept
+{
+    return read_number(p, end, number);
+}
+const bool parse_literal(const std::uint8_t* p, const std::uint8_t* end, const char* literal, const std::size_t size) noexcept
+{
+    return read_literal(p, end, literal, size);
+}
+const bool parse(const std::uint8_t* text, const std::size_t count, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    return parse_text(text, count, resource, value);
+}
+const bool parse(const infra_byte_sequence& bytes, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+    return parse_bytes(reinterpret_cast<const std::uint8_t*>(std::to_address(bytes.cbegin())), bytes.size(), resource, value);
+}
+const bool parse(const std::string& bytes, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    return parse_bytes(reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size(), resource, value);
+}
+const bool parse(const infra_string& string, std::pmr::memory_resource* resource, infra_json_value& value) noexcept
+{
+    std::vector<std::uint8_t>& text = scratch.text;
+    text.resize(string.byte_encoding_size());
+    text.resize(string.byte_encoding(text.data()));
+    return parse_text(text.data(), text.size(), resource, value);
+}
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ * @file parser.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the JSON parser used by the WHATWG infra JSON classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_JSON_PARSER_HPP
+#define SOFTLOQ_WHATWG_INFRA_JSON_PARSER_HPP
+
+#include "softloq/whatwg/infra/json/value.hpp"
+
+#include <memory_resource>
+
+/**
+ * @brief JSON parser. The structural bytes of the whole text are indexed by a vectorized kernel first, then the tokens are read from the
+ * index without recursion, with the values of each open list and map kept on a stack until it closes. */
+namespace softloq::whatwg::json
+{
+/** @brief Deepest nesting of lists and maps that is parsed. Deeper text is rejected, since destroying the value recurses. */
+constexpr std::size_t max_depth = 1024;
+
+/**
+ * @brief Indexes the structural bytes of UTF-8 JSON text with the vectorized kernel. The index is a buffer of the thread, valid until the next
+ * call on it. Returns nullptr if the text ends inside a string or is too long to index with 32-bit offsets. */
+const std::uint32_t* structural_index(const std::uint8_t* text, const std::size_t count, std::size_t& size) noexcept;
+/** @brief Frees the buffers of the thread, such as the structural index, that a large text grew past 1 MiB. Parsing calls it when done. */
+void release_scratch() noexcept;
+/** @brief Reads the JSON string whose opening quote is at quote. Returns false if it is not a valid JSON string. */
+const bool parse_string(const std::uint8_t* quote, const std::uint8_t* end, infra_string& string) noexcept;
+/** @brief Reads the JSON number that starts at p. Returns false if it is not a valid JSON number ending at a structural byte or whitespace. */
+const bool parse_number(const std::uint8_t* p, const std::uint8_t* end, double& number) noexcept;
+/** @brief Checks that the literal, such as true, is at p and ends at a structural byte or whitespace. */
+const bool parse_literal(const std::uint8_t* p, const std::uint8_t* end, const char* literal, const std::size_t size) noexcept;
+
+/** @brief Parses UTF-8 JSON text, as it is, into value. The list and map storage comes from the resource. Returns false if the text is not JSON. */
+const bool parse(const std::uint8_t* text, const std::size_t count, std::pmr::memory_resource* resource, infra_json_value& value) noexcept;
+/**
+ * @brief Parses UTF-8 JSON bytes, removing a leading byte order mark, into value. The list and map storage comes from the resource.
+ * Returns false if the bytes are not JSON. */
+const bool parse(const infra_byte_sequence& bytes, std::pmr::memory_resource* resource, infra_json_value& value) noexcept;
+const bool parse(const std::string& bytes, std::pmr::memory_resource* resource, infra_json_value& value) noexcept;
+/** @brief Parses a JSON string into value. The list and map storage comes from the resource. Returns false if the string is not JSON. */
+const bool parse(const infra_string& string, std::pmr::memory_resource* resource, infra_json_value& value) noexcept;
+}
+
+#endif
\ No newline at end of file
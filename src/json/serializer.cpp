@@ -0,0 +1,325 @@
+/**
+ * @file serializer.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra JSON serializer and sink classes.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/json/serializer.hpp"
+#include "../primitive/kernel.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+namespace softloq::whatwg
+{
+namespace
+{
+/**
+ * @brief Writes a finite number the way ECMAScript's Number::toString does, which is what JSON.stringify writes: the shortest digits that read back
+ * as the number, in plain notation from 1e-6 up to 1e21 and in exponent notation outside of it. Returns the number of characters written, at most 25. */
+const std::size_t format_number(const double number, char* out) noexcept
+{
+    char* p = out;
+    // -0 is written as 0
+    if (number == 0)
+    {
+        *p = '0';
+        return 1;
+    }
+    // integers are common and are written as they are, without searching for the shortest digits
+    if (std::fabs(number) < 9007199254740992.0 && number == std::trunc(number)) return std::to_chars(out, out + 25, static_cast<std::int64_t>(number)).ptr - out;
+    if (number < 0) *p++ = '-';
+    // scientific notation gives the shortest digits as d.ddde+x
+    char scientific[32];
+    const char* const end = std::to_chars(scientific, scientific + sizeof(scientific), std::fabs(number), std::chars_format::scientific).ptr;
+    char digits[20];
+    int k = 0;
+    const char* c = scientific;
+    for (; *c != 'e'; ++c) if (*c != '.') digits[k++] = *c;
+    int exponent = 0;
+    std::from_chars(c + (c[1] == '+' ? 2 : 1), end, exponent);
+    const int n = exponent + 1;
+    if (k <= n && n <= 21)
+    {
+        p = std::copy_n(digits, k, p);
+        p = std::fill_n(p, n - k, '0');
+    }
+    else if (0 < n && n <= 21)
+    {
+        p = std::copy_n(digits, n, p);
+        *p++ = '.';
+        p = std::copy_n(digits + n, k - n, p);
+    }
+    else if (-6 < n && n <= 0)
+    {
+        *p++ = '0';
+        *p++ = '.';
+        p = std::fill_n(p, -n, '0');
+        p = std::copy_n(digits, k, p);
+    }
+    else
+    {
+        *p++ = digits[0];
+        if (k > 1)
+        {
+            *p++ = '.';
+            p = std::copy_n(digits + 1, k - 1, p);
+        }
+        *p++ = 'e';
+        *p++ = n - 1 < 0 ? '-' : '+';
+        p = std::to_chars(p, p + 4, n - 1 < 0 ? 1 - n : n - 1).ptr;
+    }
+    return p - out;
+}
+inline const bool is_high_surrogate(const std::uint16_t unit) noexcept
+{
+    return (unit & 0xFC00) == 0xD800;
+}
+inline const bool is_low_surrogate(const std::uint16_t unit) noexcept
+{
+    return (unit & 0xFC00) == 0xDC00;
+}
+}
+
+// WHATWG JSON sink destructor //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_sink::~infra_json_sink() noexcept
+{
+}
+
+//-----------------------------//
+
+// constructors //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_serializer::infra_json_serializer(infra_byte_sequence& out) noexcept
+: out{&out}, sink{nullptr}, used{0}, separate{false}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_serializer::infra_json_serializer(infra_json_sink& sink) noexcept
+: out{nullptr}, sink{&sink}, used{0}, separate{false}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_serializer::~infra_json_serializer() noexcept
+{
+    flush();
+}
+
+//--------------//
+
+// WHATWG JSON serializer member functions //
+
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_json_value& value) noexcept
+{
+    switch (value.type())
+    {
+    case infra_json_type::infra_null: write(infra_null{}); break;
+    case infra_json_type::infra_bool: write(value.as_bool()); break;
+    case infra_json_type::infra_number: write(value.as_number()); break;
+    case infra_json_type::infra_string: write(value.as_string()); break;
+    case infra_json_type::infra_list:
+        begin_list();
+        for (const infra_json_value& item: value.as_list()) write(item);
+        end_list();
+        break;
+    case infra_json_type::infra_map:
+        begin_map();
+        for (const infra_json_value::entry_type& entry: value.as_map())
+        {
+            key(entry.first);
+            write(entry.second);
+        }
+        end_map();
+        break;
+    }
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_null&) noexcept
+{
+    separator();
+    put(reinterpret_cast<const std::uint8_t*>("null"), 4);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_bool& value) noexcept
+{
+    write(static_cast<const bool>(value));
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const bool value) noexcept
+{
+    separator();
+    if (value) put(reinterpret_cast<const std::uint8_t*>("true"), 4);
+    else put(reinterpret_cast<const std::uint8_t*>("false"), 5);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const double value) noexcept
+{
+    if (!std::isfinite(value)) return write(infra_null{});
+    separator();
+    if (chunk_size - used < 32) flush();
+    used += format_number(value, reinterpret_cast<char*>(buffer + used));
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_number_base& value) noexcept
+{
+    separator();
+    char text[24];
+    char* end = text;
+    switch (value.number_type())
+    {
+    case infra_number_type::infra_int8: end = std::to_chars(text, text + sizeof(text), static_cast<int>(static_cast<const std::int8_t>(static_cast<const infra_int8&>(value)))).ptr; break;
+    case infra_number_type::infra_int16: end = std::to_chars(text, text + sizeof(text), static_cast<const std::int16_t>(static_cast<const infra_int16&>(value))).ptr; break;
+    case infra_number_type::infra_int32: end = std::to_chars(text, text + sizeof(text), static_cast<const std::int32_t>(static_cast<const infra_int32&>(value))).ptr; break;
+    case infra_number_type::infra_int64: end = std::to_chars(text, text + sizeof(text), static_cast<const std::int64_t>(static_cast<const infra_int64&>(value))).ptr; break;
+    case infra_number_type::infra_uint8: end = std::to_chars(text, text + sizeof(text), static_cast<unsigned>(static_cast<const std::uint8_t>(static_cast<const infra_uint8&>(value)))).ptr; break;
+    case infra_number_type::infra_uint16: end = std::to_chars(text, text + sizeof(text), static_cast<const std::uint16_t>(static_cast<const infra_uint16&>(value))).ptr; break;
+    case infra_number_type::infra_uint32: end = std::to_chars(text, text + sizeof(text), static_cast<const std::uint32_t>(static_cast<const infra_uint32&>(value))).ptr; break;
+    case infra_number_type::infra_uint64: end = std::to_chars(text, text + sizeof(text), static_cast<const std::uint64_t>(static_cast<const infra_uint64&>(value))).ptr; break;
+    default: break;
+    }
+    put(reinterpret_cast<const std::uint8_t*>(text), end - text);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_string_view& value) noexcept
+{
+    separator();
+    if (value.is_wide()) put_string(value.code_units().utf16_data(), value.size());
+    else put_string(value.code_units().latin1_data(), value.size());
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::write(const infra_string& value) noexcept
+{
+    write(infra_string_view{value});
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::begin_list() noexcept
+{
+    separator();
+    put_byte(0x5B);
+    separate = false;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::end_list() noexcept
+{
+    put_byte(0x5D);
+    separate = true;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::begin_map() noexcept
+{
+    separator();
+    put_byte(0x7B);
+    separate = false;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::key(const infra_string_view& key) noexcept
+{
+    write(key);
+    put_byte(0x3A);
+    separate = false;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::end_map() noexcept
+{
+    put_byte(0x7D);
+    separate = true;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::flush() noexcept
+{
+    if (!used) return;
+    if (sink) sink->write(buffer, used);
+    else
+    {
+        // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+        const std::size_t size = out->size();
+        out->resize(size + used);
+        std::memcpy(reinterpret_cast<std::uint8_t*>(std::to_address(out->begin())) + size, buffer, used);
+    }
+    used = 0;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::separator() noexcept
+{
+    if (separate) put_byte(0x2C);
+    separate = true;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::put_byte(const std::uint8_t byte) noexcept
+{
+    if (used == chunk_size) flush();
+    buffer[used++] = byte;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::put(const std::uint8_t* bytes, std::size_t count) noexcept
+{
+    while (count)
+    {
+        if (used == chunk_size) flush();
+        const std::size_t size = std::min(count, chunk_size - used);
+        std::memcpy(buffer + used, bytes, size);
+        used += size;
+        bytes += size;
+        count -= size;
+    }
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::put_string(const std::uint8_t* units, std::size_t count) noexcept
+{
+    put_byte(0x22);
+    for (;;)
+    {
+        std::size_t run = kernel::find_json_special(units, count);
+        count -= run;
+        // a Latin-1 unit takes at most two UTF-8 bytes
+        while (run)
+        {
+            if (chunk_size - used < 2) flush();
+            const std::size_t size = std::min(run, (chunk_size - used) / 2);
+            used += kernel::utf8_encode(units, buffer + used, size);
+            units += size;
+            run -= size;
+        }
+        if (!count) break;
+        put_escape(*units++);
+        --count;
+    }
+    put_byte(0x22);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::put_string(const std::uint16_t* units, std::size_t count) noexcept
+{
+    put_byte(0x22);
+    for (;;)
+    {
+        std::size_t run = kernel::find_json_special(units, count);
+        count -= run;
+        // a UTF-16 unit takes at most three UTF-8 bytes, and a surrogate pair is never split between two pieces
+        while (run)
+        {
+            if (chunk_size - used < 6) flush();
+            std::size_t size = std::min(run, (chunk_size - used) / 3);
+            if (size < run && is_high_surrogate(units[size - 1])) --size;
+            if (kernel::is_scalar(units, size)) used += kernel::utf8_encode(units, buffer + used, size);
+            else for (std::size_t i = 0; i < size; ++i)
+            {
+                // an escaped lone surrogate takes six bytes, more than the piece was measured for
+                if (chunk_size - used < 6) flush();
+                const std::uint16_t unit = units[i];
+                if (is_high_surrogate(unit) && i + 1 < size && is_low_surrogate(units[i + 1])) used += kernel::utf8_encode(units + i++, buffer + used, 2);
+                else if (is_high_surrogate(unit) || is_low_surrogate(unit)) put_escape(unit);
+                else used += kernel::utf8_encode(units + i, buffer + used, 1);
+            }
+            units += size;
+            run -= size;
+        }
+        if (!count) break;
+        put_escape(*units++);
+        --count;
+    }
+    put_byte(0x22);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_serializer::put_escape(const std::uint16_t unit) noexcept
+{
+    std::uint8_t escape[6] = {0x5C, 0x75, 0x30, 0x30, 0x30, 0x30};
+    switch (unit)
+    {
+    case 0x08: escape[1] = 0x62; return put(escape, 2);
+    case 0x09: escape[1] = 0x74; return put(escape, 2);
+    case 0x0A: escape[1] = 0x6E; return put(escape, 2);
+    case 0x0C: escape[1] = 0x66; return put(escape, 2);
+    case 0x0D: escape[1] = 0x72; return put(escape, 2);
+    case 0x22: case 0x5C: escape[1] = static_cast<std::uint8_t>(unit); return put(escape, 2);
+    }
+    // any other control character or lone surrogate is written as \uXXXX in lowercase hex
+    constexpr char hex[] = "0123456789abcdef";
+    for (int i = 0; i < 4; ++i) escape[2 + i] = hex[unit >> (12 - 4 * i) & 0xF];
+    put(escape, 6);
+}
+
+//-----------------------------------------//
+}
\ No newline at end of file
@@ -0,0 +1,257 @@
+/**
+ * @file value.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra JSON value class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/json/value.hpp"
+#include "softloq/whatwg/infra/json/serializer.hpp"
+#include "parser.hpp"
+
+#include <memory>
+
+namespace softloq::whatwg
+{
+// constructors //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value() noexcept
+: value_type{infra_json_type::infra_null}, boolean{}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const infra_null&) noexcept
+: infra_json_value()
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const infra_bool& value) noexcept
+: infra_json_value(static_cast<const bool>(value))
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const bool value) noexcept
+: value_type{infra_json_type::infra_bool}, boolean{value}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const double value) noexcept
+: value_type{infra_json_type::infra_number}, number{value}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const infra_string& value) noexcept
+: value_type{infra_json_type::infra_string}, string{value}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(infra_string&& value) noexcept
+: value_type{infra_json_type::infra_string}, string{std::move(value)}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const list_type& value) noexcept
+: value_type{infra_json_type::infra_list}, list(value)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(list_type&& value) noexcept
+: value_type{infra_json_type::infra_list}, list(std::move(value))
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const map_type& value) noexcept
+: value_type{infra_json_type::infra_map}, map(value)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(map_type&& value) noexcept
+: value_type{infra_json_type::infra_map}, map(std::move(value))
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(const infra_json_value& src) noexcept
+: value_type{src.value_type}, boolean{}
+{
+    switch (value_type)
+    {
+    case infra_json_type::infra_bool: boolean = src.boolean; break;
+    case infra_json_type::infra_number: number = src.number; break;
+    case infra_json_type::infra_string: std::construct_at(&string, src.string); break;
+    case infra_json_type::infra_list: std::construct_at(&list, src.list); break;
+    case infra_json_type::infra_map: std::construct_at(&map, src.map); break;
+    default: break;
+    }
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::infra_json_value(infra_json_value&& src) noexcept
+: value_type{src.value_type}, boolean{}
+{
+    switch (value_type)
+    {
+    case infra_json_type::infra_bool: boolean = src.boolean; break;
+    case infra_json_type::infra_number: number = src.number; break;
+    case infra_json_type::infra_string: std::construct_at(&string, std::move(src.string)); break;
+    case infra_json_type::infra_list: std::construct_at(&list, std::move(src.list)); break;
+    case infra_json_type::infra_map: std::construct_at(&map, std::move(src.map)); break;
+    default: break;
+    }
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::~infra_json_value() noexcept
+{
+    destroy();
+}
+
+//--------------//
+
+// assignments //
+
+SOFTLOQ_WHATWG_INFRA_API infra_json_value& infra_json_value::operator=(const infra_json_value& src) noexcept
+{
+    // the source may live inside this value, so it is copied before this value is destroyed
+    if (this != &src) *this = infra_json_value{src};
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value& infra_json_value::operator=(infra_json_value&& src) noexcept
+{
+    if (this == &src) return *this;
+    infra_json_value moved{std::move(src)};
+    destroy();
+    std::construct_at(this, std::move(moved));
+    return *this;
+}
+
+//-------------//
+
+// WHATWG JSON value member functions //
+
+SOFTLOQ_WHATWG_INFRA_API const infra_json_type infra_json_value::type() const noexcept
+{
+    return value_type;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_null() const noexcept
+{
+    return value_type == infra_json_type::infra_null;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_bool() const noexcept
+{
+    return value_type == infra_json_type::infra_bool;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_number() const noexcept
+{
+    return value_type == infra_json_type::infra_number;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_string() const noexcept
+{
+    return value_type == infra_json_type::infra_string;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_list() const noexcept
+{
+    return value_type == infra_json_type::infra_list;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::is_map() const noexcept
+{
+    return value_type == infra_json_type::infra_map;
+}
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::as_bool() const noexcept
+{
+    return boolean;
+}
+SOFTLOQ_WHATWG_INFRA_API const double infra_json_value::as_number() const noexcept
+{
+    return number;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_string& infra_json_value::as_string() const noexcept
+{
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::list_type& infra_json_value::as_list() noexcept
+{
+    return list;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_json_value::list_type& infra_json_value::as_list() const noexcept
+{
+    return list;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_json_value::map_type& infra_json_value::as_map() noexcept
+{
+    return map;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_json_value::map_type& infra_json_value::as_map() const noexcept
+{
+    return map;
+}
+
+SOFTLOQ_WHATWG_INFRA_API const infra_json_value* infra_json_value::find(const infra_string_view& key) const noexcept
+{
+    if (value_type != infra_json_type::infra_map) return nullptr;
+    for (const entry_type& entry: map) if (infra_string_view{entry.first} == key) return &entry.second;
+    return nullptr;
+}
+
+//------------------------------------//
+
+// WHATWG JSON parsing functions //
+
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_value> infra_json_value::parse(const infra_byte_sequence& bytes) noexcept
+{
+    infra_json_value value;
+    if (!json::parse(bytes, std::pmr::get_default_resource(), value)) return std::nullopt;
+    return value;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_value> infra_json_value::parse(const std::string& bytes) noexcept
+{
+    infra_json_value value;
+    if (!json::parse(bytes, std::pmr::get_default_resource(), value)) return std::nullopt;
+    return value;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_json_value> infra_json_value::parse(const infra_string& string) noexcept
+{
+    infra_json_value value;
+    if (!json::parse(string, std::pmr::get_default_resource(), value)) return std::nullopt;
+    return value;
+}
+
+//-------------------------------//
+
+// WHATWG JSON serializing functions //
+
+SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_json_value::serialize() const noexcept
+{
+    infra_byte_sequence bytes;
+    {
+        infra_json_serializer serializer{bytes};
+        serializer.write(*this);
+    }
+    return bytes;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_json_value::serialize(infra_json_sink& sink) const noexcept
+{
+    infra_json_serializer serializer{sink};
+    serializer.write(*this);
+}
+
+//-----------------------------------//
+
+// WHATWG JSON value comparison functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_json_value::operator==(const infra_json_value& b) const noexcept
+{
+    if (value_type != b.value_type) return false;
+    switch (value_type)
+    {
+    case infra_json_type::infra_bool: return boolean == b.boolean;
+    case infra_json_type::infra_number: return number == b.number;
+    case infra_json_type::infra_string: return string == b.string;
+    case infra_json_type::infra_list: return list == b.list;
+    case infra_json_type::infra_map: return map == b.map;
+    default: return true;
+    }
+}
+
+//----------------------------------------//
+
+// auxiliary member functions //
+
+SOFTLOQ_WHATWG_INFRA_API void infra_json_value::destroy() noexcept
+{
+    switch (value_type)
+    {
+    case infra_json_type::infra_string: std::destroy_at(&string); break;
+    case infra_json_type::infra_list: std::destroy_at(&list); break;
+    case infra_json_type::infra_map: std::destroy_at(&map); break;
+    default: break;
+    }
+    value_type = infra_json_type::infra_null;
+}
+
+//----------------------------//
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @file base64.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra forgiving-base64 streaming encoder and decoder classes.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/primitive/base64.hpp"
+#include "kernel.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace softloq::whatwg
+{
+// base64 encoder //
+
+SOFTLOQ_WHATWG_INFRA_API infra_base64_encoder::infra_base64_encoder() noexcept
+: pending{}, pending_size{}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_base64_encoder::encode(const infra_byte_sequence& data, infra_string& out) noexcept
+{
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(std::to_address(data.cbegin()));
+    std::size_t count = data.size();
+    if (pending_size)
+    {
+        // complete the group held back by the last chunk first
+        while (pending_size < 3 && count) pending[pending_size++] = *bytes++, --count;
+        if (pending_size < 3) return;
+        write(pending, 3, out);
+        pending_size = 0;
+    }
+    const std::size_t whole = count - count % 3;
+    write(bytes, whole, out);
+    pending_size = count - whole;
+    if (pending_size) std::memcpy(pending, bytes + whole, pending_size);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_base64_encoder::finish(infra_string& out) noexcept
+{
+    write(pending, pending_size, out);
+    pending_size = 0;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_base64_encoder::write(const std::uint8_t* bytes, const std::size_t count, infra_string& out) noexcept
+{
+    if (!count) return;
+    const std::size_t size = (count + 2) / 3 * 4;
+    if (!out.wide)
+    {
+        out.grow(size);
+        out.length += kernel::base64_encode(bytes, count, out.latin1_data() + out.length);
+        return;
+    }
+    // a wide string takes the characters through a one byte buffer, a block at a time
+    std::uint8_t block[1024];
+    for (std::size_t i = 0; i < count; i += 768)
+    {
+        const std::size_t block_count = std::min<std::size_t>(768, count - i);
+        out.append_units(block, kernel::base64_encode(bytes + i, block_count, block));
+    }
+}
+
+//------------------//
+
+// base64 decoder //
+
+SOFTLOQ_WHATWG_INFRA_API infra_base64_decoder::infra_base64_decoder() noexcept
+: bits{}, sextets{}, padding{}, failed{}
+{
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_base64_decoder::decode(const infra_string_view& data, infra_byte_sequence& out) noexcept
+{
+    if (failed) return false;
+    const std::size_t offset = out.size();
+    out.resize(offset + kernel::base64_decode_capacity(data.length));
+    std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(std::to_address(out.begin())) + offset;
+    std::size_t written = 0;
+    failed = data.wide
+        ? !kernel::base64_decode(static_cast<const std::uint16_t*>(data.units), data.length, bytes, written, bits, sextets, padding)
+        : !kernel::base64_decode(static_cast<const std::uint8_t*>(data.units), data.length, bytes, written, bits, sextets, padding);
+    out.resize(offset + written);
+    return !failed;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_base64_decoder::finish(infra_byte_sequence& out) noexcept
+{
+    const bool valid = !failed;
+    failed = false;
+    const std::size_t offset = out.size();
+    out.resize(offset + 2);
+    std::size_t written = 0;
+    const bool finished = kernel::base64_finish(reinterpret_cast<std::uint8_t*>(std::to_address(out.begin())) + offset, written, bits, sextets, padding);
+    out.resize(offset + (valid ? written : 0));
+    return valid && finished;
+}
+
+//----------------//
+}
\ No newline at end of file
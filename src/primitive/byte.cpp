@@ -12,10 +12,6 @@ namespace softloq::whatwg
 {
 // constructors //
 
-SOFTLOQ_WHATWG_INFRA_API infra_byte::infra_byte() noexcept
-: data(0x00)
-{
-}
 SOFTLOQ_WHATWG_INFRA_API infra_byte::infra_byte(const std::int32_t value) noexcept
 : data(value)
 {
@@ -28,17 +24,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte::infra_byte(infra_uint8&& value) noexcept
 : data(std::move(value))
 {
 }
-SOFTLOQ_WHATWG_INFRA_API infra_byte::infra_byte(const infra_byte& src) noexcept
-: data(src.data)
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_byte::infra_byte(infra_byte&& src) noexcept
-: data(std::move(src.data))
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_byte::~infra_byte() noexcept
-{
-}
 
 //--------------//
 
@@ -59,16 +44,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte& infra_byte::operator=(infra_uint8&& value)
     infra_byte::data = std::move(value);
     return *this;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_byte& infra_byte::operator=(const infra_byte& src) noexcept
-{
-    data = src.data;
-    return *this;
-}
-SOFTLOQ_WHATWG_INFRA_API infra_byte& infra_byte::operator=(infra_byte&& src) noexcept
-{
-    data = std::move(src.data);
-    return *this;
-}
 
 //-------------//
 
@@ -85,7 +60,7 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte::operator infra_uint8() const noexcept
 
 //-------------//
 
-// WHATWG primitive base overrides //
+// WHATWG primitive functions //
 
 SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_byte::primitive_type() const noexcept
 {
@@ -93,8 +68,13 @@ SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_byte::primitive_type()
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_byte::print(std::ostream& out) const noexcept
 {
-    out << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << data;
+    out << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<std::uint16_t>(data);
+}
+SOFTLOQ_WHATWG_INFRA_API std::ostream& operator<<(std::ostream& out, const infra_byte& byte) noexcept
+{
+    byte.print(out);
+    return out;
 }
 
-//---------------------------------//
+//----------------------------//
 }
\ No newline at end of file
@@ -5,10 +5,12 @@
  * @version 1.0.0 */
 
 #include "softloq/whatwg/infra/primitive/byte_sequence.hpp"
+#include "kernel.hpp"
 
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <memory>
 
 namespace softloq::whatwg
 {
@@ -18,7 +20,7 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence() noexcept
 {
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence(const std::initializer_list<infra_byte>& values) noexcept
-: infra_sequence<infra_byte>(values)
+: sequence_type(values)
 {
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence(const std::string& values) noexcept
@@ -30,11 +32,11 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence(const std::u8s
     std::transform(values.cbegin(), values.cend(), std::back_inserter(*this), [](const std::uint8_t c) { return infra_byte{c}; });
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence(const infra_byte_sequence& src) noexcept
-: infra_sequence<infra_byte>(*static_cast<const sequence_type*>(this))
+: sequence_type(static_cast<const sequence_type&>(src))
 {
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::infra_byte_sequence(infra_byte_sequence&& src) noexcept
-: infra_sequence<infra_byte>(std::move(*static_cast<sequence_type*>(this)))
+: sequence_type(static_cast<sequence_type&&>(src))
 {
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence::~infra_byte_sequence() noexcept
@@ -65,7 +67,7 @@ SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence& infra_byte_sequence::operator=(con
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence& infra_byte_sequence::operator=(infra_byte_sequence&& src) noexcept
 {
-    *static_cast<sequence_type*>(this) = std::move(*static_cast<const sequence_type*>(&src));
+    *static_cast<sequence_type*>(this) = static_cast<sequence_type&&>(src);
     return *this;
 }
 
@@ -95,16 +97,27 @@ SOFTLOQ_WHATWG_INFRA_API std::string infra_byte_sequence::quoted_string() const
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_byte_sequence::lowercase() const noexcept
 {
-    infra_byte_sequence sequence;
-    std::transform(cbegin(), cend(), std::back_inserter(sequence), [](const auto& byte) { return std::tolower(static_cast<std::uint8_t>(byte)); });
+    infra_byte_sequence sequence{*this};
+    sequence.lowercase_in_place();
     return sequence;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_byte_sequence::uppercase() const noexcept
 {
-    infra_byte_sequence sequence;
-    std::transform(cbegin(), cend(), std::back_inserter(sequence), [](const auto& byte) { return std::toupper(static_cast<std::uint8_t>(byte)); });
+    infra_byte_sequence sequence{*this};
+    sequence.uppercase_in_place();
     return sequence;
 }
+SOFTLOQ_WHATWG_INFRA_API void infra_byte_sequence::lowercase_in_place() noexcept
+{
+    // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+    std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(std::to_address(begin()));
+    kernel::ascii_lowercase(bytes, bytes, size());
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_byte_sequence::uppercase_in_place() noexcept
+{
+    std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(std::to_address(begin()));
+    kernel::ascii_uppercase(bytes, bytes, size());
+}
 
 //-------------------------//
 
@@ -116,7 +129,7 @@ SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_byte_sequence::primiti
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_byte_sequence::print(std::ostream& out) const noexcept
 {
-    infra_sequence<infra_byte>::print(out);
+    sequence_type::print(out);
 }
 
 //---------------------------------//
@@ -152,7 +165,11 @@ SOFTLOQ_WHATWG_INFRA_API const bool is_byte_less(const infra_byte_sequence& a, c
 }
 SOFTLOQ_WHATWG_INFRA_API const bool iequal(const infra_byte_sequence& a, const infra_byte_sequence& b) noexcept
 {
-    return a.size() == b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin(), [](const auto& byte_a, const auto& byte_b) { return std::tolower(static_cast<std::uint8_t>(byte_a)) == std::tolower(static_cast<std::uint8_t>(byte_b)); });
+    return a.size() == b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin(), [](const infra_byte byte_a, const infra_byte byte_b)
+    {
+        const std::uint8_t a = byte_a, b = byte_b;
+        return (0x41 <= a && a <= 0x5A ? a | 0x20 : a) == (0x41 <= b && b <= 0x5A ? b | 0x20 : b);
+    });
 }
 
 //-------------------------------------------//
@@ -29,17 +29,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_code_point::infra_code_point(infra_uint32&& value
 : data(std::move(value))
 {
 }
-SOFTLOQ_WHATWG_INFRA_API infra_code_point::infra_code_point(const infra_code_point& src) noexcept
-: data(src.data)
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_point::infra_code_point(infra_code_point&& src) noexcept
-: data(std::move(src.data))
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_point::~infra_code_point() noexcept
-{
-}
 
 //--------------//
 
@@ -60,16 +49,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_code_point& infra_code_point::operator=(infra_uin
     infra_code_point::data = std::move(value);
     return *this;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_code_point& infra_code_point::operator=(const infra_code_point& src) noexcept
-{
-    data = src.data;
-    return *this;
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_point& infra_code_point::operator=(infra_code_point&& src) noexcept
-{
-    data = std::move(src.data);
-    return *this;
-}
 
 //-------------//
 
@@ -108,7 +87,7 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_valid() const noexcept
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_leading_surrogate() const noexcept
 {
-    return 0xD800 <= data && data <= 0xD8FF;
+    return 0xD800 <= data && data <= 0xDBFF;
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_trailing_surrogate() const noexcept
 {
@@ -116,11 +95,11 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_trailing_surrogate() co
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_surrogate() const noexcept
 {
-    return (0xD800 <= data && data <= 0xD8FF) || (0xDC00 <= data && data <= 0xDFFF);
+    return (0xD800 <= data && data <= 0xDBFF) || (0xDC00 <= data && data <= 0xDFFF);
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_scalar() const noexcept
 {
-    return !((0xD800 <= data && data <= 0xD8FF) || (0xDC00 <= data && data <= 0xDFFF));
+    return !((0xD800 <= data && data <= 0xDBFF) || (0xDC00 <= data && data <= 0xDFFF));
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_nonchar() const noexcept
 {
@@ -236,7 +215,7 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_code_point::is_alnum() const noexcept
 
 //------------------------------------//
 
-// WHATWG primitive base overrides //
+// WHATWG primitive functions //
 
 SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_code_point::primitive_type() const noexcept
 {
@@ -247,6 +226,11 @@ SOFTLOQ_WHATWG_INFRA_API void infra_code_point::print(std::ostream& out) const n
     if (data <= 0x10FFFF) out << "U+" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << data;
     else out << "U+<Invalid:" << std::hex << std::uppercase << data << ">";
 }
+SOFTLOQ_WHATWG_INFRA_API std::ostream& operator<<(std::ostream& out, const infra_code_point& point) noexcept
+{
+    point.print(out);
+    return out;
+}
 
-//---------------------------------//
+//----------------------------//
 }
\ No newline at end of file
@@ -29,17 +29,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_code_unit::infra_code_unit(infra_uint16&& value)
 : data(std::move(value))
 {
 }
-SOFTLOQ_WHATWG_INFRA_API infra_code_unit::infra_code_unit(const infra_code_unit& src) noexcept
-: data(src.data)
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_unit::infra_code_unit(infra_code_unit&& src) noexcept
-: data(std::move(src.data))
-{
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_unit::~infra_code_unit() noexcept
-{
-}
 
 //--------------//
 
@@ -60,16 +49,6 @@ SOFTLOQ_WHATWG_INFRA_API infra_code_unit& infra_code_unit::operator=(infra_uint1
     infra_code_unit::data = std::move(value);
     return *this;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_code_unit& infra_code_unit::operator=(const infra_code_unit& src) noexcept
-{
-    data = src.data;
-    return *this;
-}
-SOFTLOQ_WHATWG_INFRA_API infra_code_unit& infra_code_unit::operator=(infra_code_unit&& src) noexcept
-{
-    data = std::move(src.data);
-    return *this;
-}
 
 //-------------//
 
@@ -97,7 +76,7 @@ SOFTLOQ_WHATWG_INFRA_API std::string infra_code_unit::code_unit_str() const noex
 
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_leading_surrogate() const noexcept
 {
-    return 0xD800 <= data && data <= 0xD8FF;
+    return 0xD800 <= data && data <= 0xDBFF;
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_trailing_surrogate() const noexcept
 {
@@ -105,11 +84,11 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_trailing_surrogate() con
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_surrogate() const noexcept
 {
-    return (0xD800 <= data && data <= 0xD8FF) || (0xDC00 <= data && data <= 0xDFFF);
+    return (0xD800 <= data && data <= 0xDBFF) || (0xDC00 <= data && data <= 0xDFFF);
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_scalar() const noexcept
 {
-    return !((0xD800 <= data && data <= 0xD8FF) || (0xDC00 <= data && data <= 0xDFFF));
+    return !((0xD800 <= data && data <= 0xDBFF) || (0xDC00 <= data && data <= 0xDFFF));
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_nonchar() const noexcept
 {
@@ -193,7 +172,7 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_code_unit::is_alnum() const noexcept
 
 //-----------------------------------//
 
-// WHATWG primitive base overrides //
+// WHATWG primitive functions //
 
 SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_code_unit::primitive_type() const noexcept
 {
@@ -203,6 +182,11 @@ SOFTLOQ_WHATWG_INFRA_API void infra_code_unit::print(std::ostream& out) const no
 {
     out << "0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << data;
 }
+SOFTLOQ_WHATWG_INFRA_API std::ostream& operator<<(std::ostream& out, const infra_code_unit& unit) noexcept
+{
+    unit.print(out);
+    return out;
+}
 
-//---------------------------------//
+//----------------------------//
 }
\ No newline at end of file
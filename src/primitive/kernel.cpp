@@ -0,0 +1,1707 @@
+/**
+ * @file kernel.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the vectorized code unit kernels used by the WHATWG infra string and JSON classes.
+ * @version 1.0.0 */
+
+#include "kernel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+#include <immintrin.h>
+#define SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET(features) __attribute__((target(features)))
+#endif
+
+namespace softloq::whatwg::kernel
+{
+namespace
+{
+// scalar kernels //
+
+inline const std::uint64_t load64(const void* units) noexcept
+{
+    std::uint64_t word;
+    std::memcpy(&word, units, sizeof(word));
+    return word;
+}
+const bool is_ascii8_scalar(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) if (load64(units + i) & 0x8080808080808080) return false;
+    for (; i < count; ++i) if (units[i] & 0x80) return false;
+    return true;
+}
+/** @brief Checks that no unit has a bit of the mask set. */
+const bool is_below16_scalar(const std::uint16_t* units, const std::size_t count, const std::uint16_t mask) noexcept
+{
+    const std::uint64_t mask64 = std::uint64_t{mask} * 0x0001000100010001;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) if (load64(units + i) & mask64) return false;
+    for (; i < count; ++i) if (units[i] & mask) return false;
+    return true;
+}
+/** @brief Checks the surrogate pairs, continuing from a leading surrogate that ended the previous block if there was one. */
+const bool is_scalar16_scalar(const std::uint16_t* units, const std::size_t count, bool after_leading) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::uint16_t surrogate = units[i] & 0xFC00;
+        if (after_leading != (surrogate == 0xDC00)) return false;
+        after_leading = surrogate == 0xD800;
+    }
+    return !after_leading;
+}
+/** @brief Flips the case bit (0x20) of every unit within the range of first to first + 25, inclusive. */
+void flip_case8_scalar(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count, const std::uint8_t first) noexcept
+{
+    // per byte range check on 8 bytes at a time: the top bit of each byte is set when the byte is in range
+    const std::uint64_t ones = 0x0101010101010101;
+    const std::uint64_t tops = 0x8080808080808080;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const std::uint64_t word = load64(src + i);
+        const std::uint64_t low7 = word & ~tops;
+        const std::uint64_t at_least_first = low7 + ones * (0x80 - first);
+        const std::uint64_t past_last = low7 + ones * (0x80 - first - 26);
+        const std::uint64_t in_range = at_least_first & ~past_last & ~word & tops;
+        const std::uint64_t mapped = word ^ (in_range >> 2);
+        std::memcpy(dst + i, &mapped, sizeof(mapped));
+    }
+    for (; i < count; ++i) dst[i] = static_cast<std::uint8_t>(src[i] - first) < 26 ? src[i] ^ 0x20 : src[i];
+}
+void flip_case16_scalar(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count, const std::uint16_t first) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) dst[i] = static_cast<std::uint16_t>(src[i] - first) < 26 ? src[i] ^ 0x20 : src[i];
+}
+/** @brief Returns the index of the first U+000A LF or U+000D CR, or count if there is none. */
+const std::size_t find_newline8_scalar(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    // a zero byte in (word ^ pattern) marks a match; only bytes above the first match can be false positives
+    const std::uint64_t ones = 0x0101010101010101;
+    const std::uint64_t tops = 0x8080808080808080;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const std::uint64_t word = load64(units + i);
+        const std::uint64_t lf = word ^ (ones * 0x0A), cr = word ^ (ones * 0x0D);
+        const std::uint64_t found = (((lf - ones) & ~lf) | ((cr - ones) & ~cr)) & tops;
+        if (found) return i + (std::countr_zero(found) >> 3);
+    }
+    for (; i < count; ++i) if (units[i] == 0x0A || units[i] == 0x0D) return i;
+    return count;
+}
+const std::size_t find_newline16_scalar(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) if (units[i] == 0x0A || units[i] == 0x0D) return i;
+    return count;
+}
+/** @brief Widens the leading ASCII bytes into two byte code units. Returns the number of bytes widened. */
+const std::size_t widen_ascii8_scalar(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count && !(load64(src + i) & 0x8080808080808080); i += 8) for (std::size_t j = i; j < i + 8; ++j) dst[j] = src[j];
+    for (; i < count && src[i] < 0x80; ++i) dst[i] = src[i];
+    return i;
+}
+/** @brief Copies the leading ASCII bytes. Returns the number of bytes copied. */
+const std::size_t copy_ascii8_scalar(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count && !(load64(src + i) & 0x8080808080808080); i += 8) std::memcpy(dst + i, src + i, 8);
+    for (; i < count && src[i] < 0x80; ++i) dst[i] = src[i];
+    return i;
+}
+/** @brief Narrows the leading ASCII two byte code units into bytes. Returns the number of code units narrowed. */
+const std::size_t narrow_ascii16_scalar(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i < count && src[i] < 0x80; ++i) dst[i] = static_cast<std::uint8_t>(src[i]);
+    return i;
+}
+void widen8_scalar(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) dst[i] = src[i];
+}
+/** @brief Keeps the low byte of every two byte code unit. */
+void narrow16_scalar(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) dst[i] = static_cast<std::uint8_t>(src[i]);
+}
+/** @brief Counts the UTF-8 bytes of one byte code units: one for each unit, plus one for each unit above U+007F. */
+const std::size_t utf8_size8_scalar(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t size = count;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) size += std::popcount(load64(units + i) & 0x8080808080808080);
+    for (; i < count; ++i) size += units[i] >> 7;
+    return size;
+}
+/**
+ * @brief Counts the UTF-8 bytes of two byte code units, continuing from a leading surrogate that ended the previous block if there was one.
+ * A surrogate pair takes four bytes, and a lone surrogate takes the three bytes of U+FFFD. */
+const std::size_t utf8_size16_scalar(const std::uint16_t* units, const std::size_t count, bool after_leading) noexcept
+{
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::uint16_t unit = units[i];
+        size += 1 + (unit >= 0x80) + (unit >= 0x800);
+        if (after_leading && (unit & 0xFC00) == 0xDC00) size -= 2;
+        after_leading = (unit & 0xFC00) == 0xD800;
+    }
+    return size;
+}
+
+/** @brief Base64 alphabet value of each byte: 0 to 63 for the alphabet, then base64_space for ASCII whitespace, base64_pad for U+003D (=), and base64_invalid. */
+constexpr std::uint8_t base64_space = 64, base64_pad = 65, base64_invalid = 255;
+constexpr struct base64_table
+{
+    std::uint8_t values[256];
+    constexpr base64_table() noexcept : values()
+    {
+        for (std::uint8_t& value: values) value = base64_invalid;
+        const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        for (std::uint8_t i = 0; i < 64; ++i) values[static_cast<std::uint8_t>(alphabet[i])] = i;
+        for (const std::uint8_t space: {0x09, 0x0A, 0x0C, 0x0D, 0x20}) values[space] = base64_space;
+        values[0x3D] = base64_pad;
+    }
+} base64_values;
+constexpr char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/** @brief Encodes whole groups of three bytes into four characters each. Returns the number of bytes encoded. */
+const std::size_t base64_encode_scalar(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 3 <= count; i += 3, dst += 4)
+    {
+        const std::uint32_t group = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        dst[0] = base64_alphabet[group >> 18];
+        dst[1] = base64_alphabet[(group >> 12) & 0x3F];
+        dst[2] = base64_alphabet[(group >> 6) & 0x3F];
+        dst[3] = base64_alphabet[group & 0x3F];
+    }
+    return i;
+}
+/**
+ * @brief Decodes characters one at a time, skipping ASCII whitespace and carrying a partial group of sextets in bits and sextets.
+ * Stops after at least count characters once no partial group is carried, or at the end. Returns false on a character outside the alphabet,
+ * or on an alphabet character after padding. */
+template <typename unit_type>
+const bool base64_decode_scalar(const unit_type* src, const std::size_t count, std::size_t& i, const std::size_t stop, std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept
+{
+    for (; i < count && (i < stop || sextets & 3); ++i)
+    {
+        const std::uint8_t value = src[i] < 0x100 ? base64_values.values[src[i]] : base64_invalid;
+        if (value < 64)
+        {
+            if (padding) return false;
+            bits = (bits << 6) | value;
+            if ((++sextets & 3) == 0)
+            {
+                dst[written++] = static_cast<std::uint8_t>(bits >> 16);
+                dst[written++] = static_cast<std::uint8_t>(bits >> 8);
+                dst[written++] = static_cast<std::uint8_t>(bits);
+                bits = 0;
+            }
+        }
+        else if (value == base64_pad) ++padding;
+        else if (value != base64_space) return false;
+    }
+    return true;
+}
+
+/** @brief Bit masks of one 64 byte block of JSON text, one bit per byte. */
+struct json_block
+{
+    std::uint64_t quote;
+    std::uint64_t backslash;
+    std::uint64_t op;
+    std::uint64_t space;
+};
+const json_block classify_json_scalar(const std::uint8_t* src) noexcept
+{
+    json_block block{};
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+        const std::uint64_t bit = std::uint64_t{1} << i;
+        switch (src[i])
+        {
+        case 0x22: block.quote |= bit; break;
+        case 0x5C: block.backslash |= bit; break;
+        case 0x2C: case 0x3A: case 0x5B: case 0x5D: case 0x7B: case 0x7D: block.op |= bit; break;
+        case 0x09: case 0x0A: case 0x0D: case 0x20: block.space |= bit; break;
+        }
+    }
+    return block;
+}
+/** @brief Returns the index of the first U+0022 ("), U+005C (\) or C0 control byte, or count if there is none. */
+const std::size_t find_json_special_scalar(const std::uint8_t* src, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) if (src[i] == 0x22 || src[i] == 0x5C || src[i] < 0x20) return i;
+    return count;
+}
+const std::size_t find_json_special_scalar(const std::uint16_t* src, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i) if (src[i] == 0x22 || src[i] == 0x5C || src[i] < 0x20) return i;
+    return count;
+}
+
+//----------------//
+
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+
+// SSE2 kernels //
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const bool is_ascii8_sse2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 32));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 48));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) return false;
+    }
+    for (; i + 16 <= count; i += 16) if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i)))) return false;
+    return is_ascii8_scalar(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const bool is_below16_sse2(const std::uint16_t* units, const std::size_t count, const std::uint16_t mask) noexcept
+{
+    const __m128i mask128 = _mm_set1_epi16(static_cast<short>(mask));
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 8));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 16));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i + 24));
+        const __m128i masked = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), mask128);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(masked, zero)) != 0xFFFF) return false;
+    }
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i masked = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i)), mask128);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(masked, zero)) != 0xFFFF) return false;
+    }
+    return is_below16_scalar(units + i, count - i, mask);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const bool is_scalar16_sse2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    // every trailing surrogate must follow a leading surrogate: the trailing mask equals the leading mask moved up one unit (two mask bits)
+    const __m128i surrogate_bits = _mm_set1_epi16(static_cast<short>(0xFC00));
+    const __m128i leading = _mm_set1_epi16(static_cast<short>(0xD800));
+    const __m128i trailing = _mm_set1_epi16(static_cast<short>(0xDC00));
+    std::uint32_t carry = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i surrogates = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i)), surrogate_bits);
+        const std::uint32_t leading_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(surrogates, leading));
+        const std::uint32_t trailing_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(surrogates, trailing));
+        if (trailing_mask != (((leading_mask << 2) | carry) & 0xFFFF)) return false;
+        carry = leading_mask >> 14;
+    }
+    return is_scalar16_scalar(units + i, count - i, carry);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+void flip_case8_sse2(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count, const std::uint8_t first) noexcept
+{
+    // SSE2 only compares signed bytes: moving first to -128 puts the range at -128 to -103
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - first));
+    const __m128i limit = _mm_set1_epi8(-128 + 26);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i in_range = _mm_cmplt_epi8(_mm_add_epi8(units, bias), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(units, _mm_and_si128(in_range, flip)));
+    }
+    flip_case8_scalar(src + i, dst + i, count - i, first);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+void flip_case16_sse2(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count, const std::uint16_t first) noexcept
+{
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000 - first));
+    const __m128i limit = _mm_set1_epi16(-32768 + 26);
+    const __m128i flip = _mm_set1_epi16(0x20);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i in_range = _mm_cmplt_epi16(_mm_add_epi16(units, bias), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(units, _mm_and_si128(in_range, flip)));
+    }
+    flip_case16_scalar(src + i, dst + i, count - i, first);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t find_newline8_sse2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    const __m128i lf = _mm_set1_epi8(0x0A);
+    const __m128i cr = _mm_set1_epi8(0x0D);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i));
+        const std::uint32_t found = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, lf), _mm_cmpeq_epi8(block, cr)));
+        if (found) return i + std::countr_zero(found);
+    }
+    return i + find_newline8_scalar(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t find_newline16_sse2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m128i lf = _mm_set1_epi16(0x0A);
+    const __m128i cr = _mm_set1_epi16(0x0D);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i));
+        const std::uint32_t found = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(block, lf), _mm_cmpeq_epi16(block, cr)));
+        if (found) return i + (std::countr_zero(found) >> 1);
+    }
+    return i + find_newline16_scalar(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t widen_ascii8_sse2(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(block)) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(block, zero));
+    }
+    return i + widen_ascii8_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t copy_ascii8_sse2(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(block)) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), block);
+    }
+    return i + copy_ascii8_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t narrow_ascii16_sse2(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), non_ascii), zero)) != 0xFFFF) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+    }
+    return i + narrow_ascii16_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+void widen8_sse2(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(block, zero));
+    }
+    widen8_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+void narrow16_sse2(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    // packus saturates, so the high bytes are cleared first
+    const __m128i low_byte = _mm_set1_epi16(0x00FF);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), low_byte);
+        const __m128i b = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)), low_byte);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+    }
+    narrow16_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t utf8_size8_sse2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t size = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) size += 16 + std::popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i)))));
+    return size + utf8_size8_scalar(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t utf8_size16_sse2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    // three bytes per unit, less one for each unit below U+0800 and one more for each unit below U+0080, less two for each surrogate pair;
+    // the compare masks have two bits per unit
+    const __m128i two_byte = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i three_byte = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogate_bits = _mm_set1_epi16(static_cast<short>(0xFC00));
+    const __m128i leading = _mm_set1_epi16(static_cast<short>(0xD800));
+    const __m128i trailing = _mm_set1_epi16(static_cast<short>(0xDC00));
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t size = 0;
+    std::uint32_t carry = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(units + i));
+        const std::uint32_t below_two_byte = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, two_byte), zero));
+        const std::uint32_t below_three_byte = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, three_byte), zero));
+        const __m128i surrogates = _mm_and_si128(block, surrogate_bits);
+        const std::uint32_t leading_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(surrogates, leading));
+        const std::uint32_t trailing_mask = _mm_movemask_epi8(_mm_cmpeq_epi16(surrogates, trailing));
+        const std::uint32_t pairs = ((leading_mask << 2) | carry) & trailing_mask;
+        size += 24 - ((std::popcount(below_two_byte) + std::popcount(below_three_byte) + 2 * std::popcount(pairs)) >> 1);
+        carry = (leading_mask >> 14) & 0x3;
+    }
+    return size + utf8_size16_scalar(units + i, count - i, carry);
+}
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const json_block classify_json_sse2(const std::uint8_t* src) noexcept
+{
+    // folding in 0x20 maps [ and ] onto { and }
+    const __m128i quote = _mm_set1_epi8(0x22), backslash = _mm_set1_epi8(0x5C), comma = _mm_set1_epi8(0x2C), colon = _mm_set1_epi8(0x3A);
+    const __m128i open = _mm_set1_epi8(0x7B), close = _mm_set1_epi8(0x7D), fold = _mm_set1_epi8(0x20);
+    const __m128i tab = _mm_set1_epi8(0x09), lf = _mm_set1_epi8(0x0A), cr = _mm_set1_epi8(0x0D);
+    json_block block{};
+    for (std::size_t i = 0; i < 64; i += 16)
+    {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i folded = _mm_or_si128(units, fold);
+        const __m128i op = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, open), _mm_cmpeq_epi8(folded, close)), _mm_or_si128(_mm_cmpeq_epi8(units, comma), _mm_cmpeq_epi8(units, colon)));
+        const __m128i space = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(units, fold), _mm_cmpeq_epi8(units, tab)), _mm_or_si128(_mm_cmpeq_epi8(units, lf), _mm_cmpeq_epi8(units, cr)));
+        block.quote |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(units, quote)))} << i;
+        block.backslash |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(units, backslash)))} << i;
+        block.op |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(op))} << i;
+        block.space |= std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(space))} << i;
+    }
+    return block;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t find_json_special_sse2(const std::uint8_t* src, const std::size_t count) noexcept
+{
+    const __m128i quote = _mm_set1_epi8(0x22), backslash = _mm_set1_epi8(0x5C), control = _mm_set1_epi8(0x1F);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(units, quote), _mm_cmpeq_epi8(units, backslash)), _mm_cmpeq_epi8(_mm_min_epu8(units, control), units));
+        const std::uint32_t found = _mm_movemask_epi8(special);
+        if (found) return i + std::countr_zero(found);
+    }
+    return i + find_json_special_scalar(src + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("sse2")
+const std::size_t find_json_special_sse2(const std::uint16_t* src, const std::size_t count) noexcept
+{
+    const __m128i quote = _mm_set1_epi16(0x22), backslash = _mm_set1_epi16(0x5C), control = _mm_set1_epi16(0x1F), zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // SSE2 has no unsigned 16-bit compare, but a saturating subtract leaves zero exactly for the units up to U+001F
+        const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(units, quote), _mm_cmpeq_epi16(units, backslash)), _mm_cmpeq_epi16(_mm_subs_epu16(units, control), zero));
+        const std::uint32_t found = _mm_movemask_epi8(special);
+        if (found) return i + (std::countr_zero(found) >> 1);
+    }
+    return i + find_json_special_scalar(src + i, count - i);
+}
+
+//--------------//
+
+// AVX2 kernels //
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const bool is_ascii8_avx2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 128 <= count; i += 128)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 32));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 64));
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 96));
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)))) return false;
+    }
+    for (; i + 32 <= count; i += 32) if (_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i)))) return false;
+    return is_ascii8_sse2(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const bool is_below16_avx2(const std::uint16_t* units, const std::size_t count, const std::uint16_t mask) noexcept
+{
+    const __m256i mask256 = _mm256_set1_epi16(static_cast<short>(mask));
+    std::size_t i = 0;
+    for (; i + 64 <= count; i += 64)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 16));
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 32));
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i + 48));
+        if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), mask256)) return false;
+    }
+    for (; i + 16 <= count; i += 16) if (!_mm256_testz_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i)), mask256)) return false;
+    return is_below16_sse2(units + i, count - i, mask);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const bool is_scalar16_avx2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m256i surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xFC00));
+    const __m256i leading = _mm256_set1_epi16(static_cast<short>(0xD800));
+    const __m256i trailing = _mm256_set1_epi16(static_cast<short>(0xDC00));
+    std::uint32_t carry = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i surrogates = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i)), surrogate_bits);
+        const std::uint32_t leading_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(surrogates, leading));
+        const std::uint32_t trailing_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(surrogates, trailing));
+        if (trailing_mask != ((leading_mask << 2) | carry)) return false;
+        carry = leading_mask >> 30;
+    }
+    return is_scalar16_scalar(units + i, count - i, carry);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+void flip_case8_avx2(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count, const std::uint8_t first) noexcept
+{
+    const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80 - first));
+    const __m256i limit = _mm256_set1_epi8(-128 + 26);
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i in_range = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(units, bias));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(units, _mm256_and_si256(in_range, flip)));
+    }
+    flip_case8_sse2(src + i, dst + i, count - i, first);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+void flip_case16_avx2(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count, const std::uint16_t first) noexcept
+{
+    const __m256i bias = _mm256_set1_epi16(static_cast<short>(0x8000 - first));
+    const __m256i limit = _mm256_set1_epi16(-32768 + 26);
+    const __m256i flip = _mm256_set1_epi16(0x20);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i in_range = _mm256_cmpgt_epi16(limit, _mm256_add_epi16(units, bias));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(units, _mm256_and_si256(in_range, flip)));
+    }
+    flip_case16_sse2(src + i, dst + i, count - i, first);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t find_newline8_avx2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    const __m256i lf = _mm256_set1_epi8(0x0A);
+    const __m256i cr = _mm256_set1_epi8(0x0D);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i));
+        const std::uint32_t found = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, lf), _mm256_cmpeq_epi8(block, cr)));
+        if (found) return i + std::countr_zero(found);
+    }
+    return i + find_newline8_sse2(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t find_newline16_avx2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m256i lf = _mm256_set1_epi16(0x0A);
+    const __m256i cr = _mm256_set1_epi16(0x0D);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i));
+        const std::uint32_t found = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi16(block, lf), _mm256_cmpeq_epi16(block, cr)));
+        if (found) return i + (std::countr_zero(found) >> 1);
+    }
+    return i + find_newline16_sse2(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t widen_ascii8_avx2(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_movemask_epi8(block)) break;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+    }
+    return i + widen_ascii8_sse2(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t copy_ascii8_avx2(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_movemask_epi8(block)) break;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), block);
+    }
+    return i + copy_ascii8_sse2(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t narrow_ascii16_avx2(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    const __m256i non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16));
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), non_ascii)) break;
+        // packus works within 128 bit lanes, so the 64 bit quarters are put back in order
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    return i + narrow_ascii16_sse2(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+void widen8_avx2(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu8_epi16(block));
+    }
+    widen8_scalar(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+void narrow16_avx2(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    const __m256i low_byte = _mm256_set1_epi16(0x00FF);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i a = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), low_byte);
+        const __m256i b = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16)), low_byte);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+    }
+    narrow16_sse2(src + i, dst + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t utf8_size8_avx2(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t size = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) size += 32 + std::popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i)))));
+    return size + utf8_size8_sse2(units + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t utf8_size16_avx2(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m256i two_byte = _mm256_set1_epi16(static_cast<short>(0xFF80));
+    const __m256i three_byte = _mm256_set1_epi16(static_cast<short>(0xF800));
+    const __m256i surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xFC00));
+    const __m256i leading = _mm256_set1_epi16(static_cast<short>(0xD800));
+    const __m256i trailing = _mm256_set1_epi16(static_cast<short>(0xDC00));
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t size = 0;
+    std::uint32_t carry = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(units + i));
+        const std::uint32_t below_two_byte = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, two_byte), zero));
+        const std::uint32_t below_three_byte = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, three_byte), zero));
+        const __m256i surrogates = _mm256_and_si256(block, surrogate_bits);
+        const std::uint32_t leading_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(surrogates, leading));
+        const std::uint32_t trailing_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(surrogates, trailing));
+        const std::uint32_t pairs = ((leading_mask << 2) | carry) & trailing_mask;
+        size += 48 - ((std::popcount(below_two_byte) + std::popcount(below_three_byte) + 2 * std::popcount(pairs)) >> 1);
+        carry = leading_mask >> 30;
+    }
+    return size + utf8_size16_scalar(units + i, count - i, carry);
+}
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t base64_encode_avx2(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst) noexcept
+{
+    // each 128 bit lane takes 12 bytes, spreads every 3 bytes over 4 bytes and moves the 6 bit fields into place with multiplies,
+    // then adds the offset of the alphabet range each field falls in
+    const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    std::size_t i = 0;
+    for (; i + 28 <= count; i += 24, dst += 32)
+    {
+        const __m256i block = _mm256_shuffle_epi8(_mm256_setr_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12))), spread);
+        const __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(block, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i low = _mm256_mullo_epi16(_mm256_and_si256(block, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i fields = _mm256_or_si256(high, low);
+        // 0 to 25 map to offset 13, 26 to 51 to offset 0, 52 to 61 to offsets 1 to 10, 62 to 11 and 63 to 12
+        __m256i range = _mm256_subs_epu8(fields, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), fields), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_add_epi8(fields, _mm256_shuffle_epi8(offsets, range)));
+    }
+    return i + base64_encode_scalar(src + i, count - i, dst);
+}
+/**
+ * @brief Decodes blocks of 32 alphabet characters into 24 bytes each, stopping at the group holding the first character outside the alphabet.
+ * Writes 32 bytes per block, so the destination needs 8 bytes of slack. Returns the number of characters decoded. */
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t base64_decode_avx2(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst) noexcept
+{
+    // the nibble tables flag anything outside the alphabet, and the roll table holds the offset back to the 6 bit value for each range
+    const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i slash = _mm256_set1_epi8(0x2F);
+    const __m256i gather = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32, dst += 24)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(block, 4), slash);
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(block, slash));
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        const std::uint32_t invalid = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256())));
+        const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(block, slash), hi_nibbles));
+        block = _mm256_add_epi8(block, roll);
+        // pack 4 sextets into 3 bytes per 32 bit group, then gather the 24 bytes to the front
+        block = _mm256_madd_epi16(_mm256_maddubs_epi16(block, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        block = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(block, gather), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), block);
+        if (invalid)
+        {
+            // the whole groups in front of the first character outside the alphabet are decoded already
+            i += std::countr_zero(invalid) & ~3u;
+            break;
+        }
+    }
+    return i;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const json_block classify_json_avx2(const std::uint8_t* src) noexcept
+{
+    const __m256i quote = _mm256_set1_epi8(0x22), backslash = _mm256_set1_epi8(0x5C), comma = _mm256_set1_epi8(0x2C), colon = _mm256_set1_epi8(0x3A);
+    const __m256i open = _mm256_set1_epi8(0x7B), close = _mm256_set1_epi8(0x7D), fold = _mm256_set1_epi8(0x20);
+    const __m256i tab = _mm256_set1_epi8(0x09), lf = _mm256_set1_epi8(0x0A), cr = _mm256_set1_epi8(0x0D);
+    json_block block{};
+    for (std::size_t i = 0; i < 64; i += 32)
+    {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i folded = _mm256_or_si256(units, fold);
+        const __m256i op = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(folded, open), _mm256_cmpeq_epi8(folded, close)), _mm256_or_si256(_mm256_cmpeq_epi8(units, comma), _mm256_cmpeq_epi8(units, colon)));
+        const __m256i space = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(units, fold), _mm256_cmpeq_epi8(units, tab)), _mm256_or_si256(_mm256_cmpeq_epi8(units, lf), _mm256_cmpeq_epi8(units, cr)));
+        block.quote |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(units, quote)))} << i;
+        block.backslash |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(units, backslash)))} << i;
+        block.op |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(op))} << i;
+        block.space |= std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(space))} << i;
+    }
+    return block;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t find_json_special_avx2(const std::uint8_t* src, const std::size_t count) noexcept
+{
+    const __m256i quote = _mm256_set1_epi8(0x22), backslash = _mm256_set1_epi8(0x5C), control = _mm256_set1_epi8(0x1F);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(units, quote), _mm256_cmpeq_epi8(units, backslash)), _mm256_cmpeq_epi8(_mm256_min_epu8(units, control), units));
+        const std::uint32_t found = _mm256_movemask_epi8(special);
+        if (found) return i + std::countr_zero(found);
+    }
+    return i + find_json_special_sse2(src + i, count - i);
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx2")
+const std::size_t find_json_special_avx2(const std::uint16_t* src, const std::size_t count) noexcept
+{
+    const __m256i quote = _mm256_set1_epi16(0x22), backslash = _mm256_set1_epi16(0x5C), control = _mm256_set1_epi16(0x1F), zero = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi16(units, quote), _mm256_cmpeq_epi16(units, backslash)), _mm256_cmpeq_epi16(_mm256_subs_epu16(units, control), zero));
+        const std::uint32_t found = _mm256_movemask_epi8(special);
+        if (found) return i + (std::countr_zero(found) >> 1);
+    }
+    return i + find_json_special_sse2(src + i, count - i);
+}
+
+//--------------//
+
+// AVX-512 kernels //
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const bool is_ascii8_avx512(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 256 <= count; i += 256)
+    {
+        const __m512i a = _mm512_loadu_si512(units + i);
+        const __m512i b = _mm512_loadu_si512(units + i + 64);
+        const __m512i c = _mm512_loadu_si512(units + i + 128);
+        const __m512i d = _mm512_loadu_si512(units + i + 192);
+        if (_mm512_movepi8_mask(_mm512_or_si512(_mm512_or_si512(a, b), _mm512_or_si512(c, d)))) return false;
+    }
+    for (; i < count; i += 64)
+    {
+        // the tail is loaded under a mask, so nothing past the end is read
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        if (_mm512_movepi8_mask(_mm512_maskz_loadu_epi8(lanes, units + i))) return false;
+    }
+    return true;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const bool is_below16_avx512(const std::uint16_t* units, const std::size_t count, const std::uint16_t mask) noexcept
+{
+    const __m512i mask512 = _mm512_set1_epi16(static_cast<short>(mask));
+    std::size_t i = 0;
+    for (; i + 128 <= count; i += 128)
+    {
+        const __m512i a = _mm512_loadu_si512(units + i);
+        const __m512i b = _mm512_loadu_si512(units + i + 32);
+        const __m512i c = _mm512_loadu_si512(units + i + 64);
+        const __m512i d = _mm512_loadu_si512(units + i + 96);
+        if (_mm512_test_epi16_mask(_mm512_or_si512(_mm512_or_si512(a, b), _mm512_or_si512(c, d)), mask512)) return false;
+    }
+    for (; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        if (_mm512_test_epi16_mask(_mm512_maskz_loadu_epi16(lanes, units + i), mask512)) return false;
+    }
+    return true;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const bool is_scalar16_avx512(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m512i surrogate_bits = _mm512_set1_epi16(static_cast<short>(0xFC00));
+    const __m512i leading = _mm512_set1_epi16(static_cast<short>(0xD800));
+    const __m512i trailing = _mm512_set1_epi16(static_cast<short>(0xDC00));
+    std::uint32_t carry = 0;
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        // zeroed lanes past the end are not surrogates, so a leading surrogate in the last unit fails the check below
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i surrogates = _mm512_and_si512(_mm512_maskz_loadu_epi16(lanes, units + i), surrogate_bits);
+        const std::uint32_t leading_mask = _mm512_cmpeq_epi16_mask(surrogates, leading);
+        const std::uint32_t trailing_mask = _mm512_cmpeq_epi16_mask(surrogates, trailing);
+        if (trailing_mask != ((leading_mask << 1) | carry)) return false;
+        carry = leading_mask >> 31;
+    }
+    return !carry;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+void flip_case8_avx512(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count, const std::uint8_t first) noexcept
+{
+    const __m512i lowest = _mm512_set1_epi8(static_cast<char>(first));
+    const __m512i range = _mm512_set1_epi8(26);
+    const __m512i flip = _mm512_set1_epi8(0x20);
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        const __m512i units = _mm512_maskz_loadu_epi8(lanes, src + i);
+        const __mmask64 in_range = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(units, lowest), range);
+        _mm512_mask_storeu_epi8(dst + i, lanes, _mm512_xor_si512(units, _mm512_maskz_mov_epi8(in_range, flip)));
+    }
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+void flip_case16_avx512(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count, const std::uint16_t first) noexcept
+{
+    const __m512i lowest = _mm512_set1_epi16(static_cast<short>(first));
+    const __m512i range = _mm512_set1_epi16(26);
+    const __m512i flip = _mm512_set1_epi16(0x20);
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i units = _mm512_maskz_loadu_epi16(lanes, src + i);
+        const __mmask32 in_range = _mm512_cmplt_epu16_mask(_mm512_sub_epi16(units, lowest), range);
+        _mm512_mask_storeu_epi16(dst + i, lanes, _mm512_xor_si512(units, _mm512_maskz_mov_epi16(in_range, flip)));
+    }
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t find_newline8_avx512(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    const __m512i lf = _mm512_set1_epi8(0x0A);
+    const __m512i cr = _mm512_set1_epi8(0x0D);
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi8(lanes, units + i);
+        const std::uint64_t found = lanes & (_mm512_cmpeq_epi8_mask(block, lf) | _mm512_cmpeq_epi8_mask(block, cr));
+        if (found) return i + std::countr_zero(found);
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t find_newline16_avx512(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m512i lf = _mm512_set1_epi16(0x0A);
+    const __m512i cr = _mm512_set1_epi16(0x0D);
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi16(lanes, units + i);
+        const std::uint32_t found = lanes & (_mm512_cmpeq_epi16_mask(block, lf) | _mm512_cmpeq_epi16_mask(block, cr));
+        if (found) return i + std::countr_zero(found);
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t widen_ascii8_avx512(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi8(lanes, src + i);
+        // only the bytes before the first non-ASCII byte are stored
+        const std::uint64_t non_ascii = _mm512_movepi8_mask(block) | ~lanes;
+        const std::size_t ascii = non_ascii ? std::countr_zero(non_ascii) : 64;
+        const __mmask32 low = ascii >= 32 ? ~__mmask32{0} : (__mmask32{1} << ascii) - 1;
+        const __mmask32 high = ascii >= 64 ? ~__mmask32{0} : ascii > 32 ? (__mmask32{1} << (ascii - 32)) - 1 : 0;
+        _mm512_mask_storeu_epi16(dst + i, low, _mm512_cvtepu8_epi16(_mm512_castsi512_si256(block)));
+        _mm512_mask_storeu_epi16(dst + i + 32, high, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(block, 1)));
+        if (ascii < 64) return i + ascii;
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t copy_ascii8_avx512(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi8(lanes, src + i);
+        const std::uint64_t non_ascii = _mm512_movepi8_mask(block) | ~lanes;
+        const std::size_t ascii = non_ascii ? std::countr_zero(non_ascii) : 64;
+        _mm512_mask_storeu_epi8(dst + i, ascii >= 64 ? ~__mmask64{0} : (__mmask64{1} << ascii) - 1, block);
+        if (ascii < 64) return i + ascii;
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t narrow_ascii16_avx512(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    const __m512i ascii_limit = _mm512_set1_epi16(0x80);
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi16(lanes, src + i);
+        const std::uint32_t non_ascii = _mm512_cmpge_epu16_mask(block, ascii_limit) | ~lanes;
+        const std::size_t ascii = non_ascii ? std::countr_zero(non_ascii) : 32;
+        const __mmask64 stored = ascii >= 32 ? 0xFFFFFFFF : (__mmask64{1} << ascii) - 1;
+        _mm512_mask_storeu_epi8(dst + i, stored, _mm512_castsi256_si512(_mm512_cvtepi16_epi8(block)));
+        if (ascii < 32) return i + ascii;
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+void widen8_avx512(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i block = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(lanes, src + i)));
+        _mm512_mask_storeu_epi16(dst + i, lanes, block);
+    }
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+void narrow16_avx512(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m256i block = _mm512_cvtepi16_epi8(_mm512_maskz_loadu_epi16(lanes, src + i));
+        _mm512_mask_storeu_epi8(dst + i, lanes, _mm512_castsi256_si512(block));
+    }
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t utf8_size8_avx512(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    std::size_t size = count;
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        size += std::popcount(_mm512_movepi8_mask(_mm512_maskz_loadu_epi8(lanes, units + i)));
+    }
+    return size;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t utf8_size16_avx512(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    const __m512i two_byte = _mm512_set1_epi16(0x80);
+    const __m512i three_byte = _mm512_set1_epi16(0x800);
+    const __m512i surrogate_bits = _mm512_set1_epi16(static_cast<short>(0xFC00));
+    const __m512i leading = _mm512_set1_epi16(static_cast<short>(0xD800));
+    const __m512i trailing = _mm512_set1_epi16(static_cast<short>(0xDC00));
+    std::size_t size = count;
+    std::uint32_t carry = 0;
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        // zeroed lanes past the end count for nothing: they are below U+0080 and not surrogates
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i block = _mm512_maskz_loadu_epi16(lanes, units + i);
+        const __m512i surrogates = _mm512_and_si512(block, surrogate_bits);
+        const std::uint32_t leading_mask = _mm512_cmpeq_epi16_mask(surrogates, leading);
+        const std::uint32_t pairs = ((leading_mask << 1) | carry) & _mm512_cmpeq_epi16_mask(surrogates, trailing);
+        size += std::popcount(_mm512_cmpge_epu16_mask(block, two_byte)) + std::popcount(_mm512_cmpge_epu16_mask(block, three_byte)) - 2 * std::popcount(pairs);
+        carry = leading_mask >> 31;
+    }
+    return size;
+}
+
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const json_block classify_json_avx512(const std::uint8_t* src) noexcept
+{
+    const __m512i units = _mm512_loadu_si512(src);
+    const __m512i folded = _mm512_or_si512(units, _mm512_set1_epi8(0x20));
+    json_block block;
+    block.quote = _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x22));
+    block.backslash = _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x5C));
+    block.op = _mm512_cmpeq_epi8_mask(folded, _mm512_set1_epi8(0x7B)) | _mm512_cmpeq_epi8_mask(folded, _mm512_set1_epi8(0x7D))
+             | _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x2C)) | _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x3A));
+    block.space = _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x20)) | _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x09))
+                | _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x0A)) | _mm512_cmpeq_epi8_mask(units, _mm512_set1_epi8(0x0D));
+    return block;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t find_json_special_avx512(const std::uint8_t* src, const std::size_t count) noexcept
+{
+    const __m512i quote = _mm512_set1_epi8(0x22), backslash = _mm512_set1_epi8(0x5C), control = _mm512_set1_epi8(0x20);
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        const __mmask64 lanes = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+        const __m512i units = _mm512_maskz_loadu_epi8(lanes, src + i);
+        const std::uint64_t found = lanes & (_mm512_cmpeq_epi8_mask(units, quote) | _mm512_cmpeq_epi8_mask(units, backslash) | _mm512_cmplt_epu8_mask(units, control));
+        if (found) return i + std::countr_zero(found);
+    }
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_KERNEL_TARGET("avx512f,avx512bw")
+const std::size_t find_json_special_avx512(const std::uint16_t* src, const std::size_t count) noexcept
+{
+    const __m512i quote = _mm512_set1_epi16(0x22), backslash = _mm512_set1_epi16(0x5C), control = _mm512_set1_epi16(0x20);
+    for (std::size_t i = 0; i < count; i += 32)
+    {
+        const __mmask32 lanes = count - i >= 32 ? ~__mmask32{0} : (__mmask32{1} << (count - i)) - 1;
+        const __m512i units = _mm512_maskz_loadu_epi16(lanes, src + i);
+        const std::uint32_t found = lanes & (_mm512_cmpeq_epi16_mask(units, quote) | _mm512_cmpeq_epi16_mask(units, backslash) | _mm512_cmplt_epu16_mask(units, control));
+        if (found) return i + std::countr_zero(found);
+    }
+    return count;
+}
+
+//-----------------//
+
+#endif
+
+const isa detect_isa() noexcept
+{
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return isa::avx512;
+    if (__builtin_cpu_supports("avx2")) return isa::avx2;
+    if (__builtin_cpu_supports("sse2")) return isa::sse2;
+#endif
+    return isa::scalar;
+}
+}
+
+// dispatch //
+
+const isa active_isa() noexcept
+{
+    static const isa level = detect_isa();
+    return level;
+}
+
+const bool is_ascii(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return is_ascii8_avx512(units, count);
+    case isa::avx2: return is_ascii8_avx2(units, count);
+    case isa::sse2: return is_ascii8_sse2(units, count);
+#endif
+    default: return is_ascii8_scalar(units, count);
+    }
+}
+const bool is_ascii(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return is_below16_avx512(units, count, 0xFF80);
+    case isa::avx2: return is_below16_avx2(units, count, 0xFF80);
+    case isa::sse2: return is_below16_sse2(units, count, 0xFF80);
+#endif
+    default: return is_below16_scalar(units, count, 0xFF80);
+    }
+}
+const bool is_isomorphic(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return is_below16_avx512(units, count, 0xFF00);
+    case isa::avx2: return is_below16_avx2(units, count, 0xFF00);
+    case isa::sse2: return is_below16_sse2(units, count, 0xFF00);
+#endif
+    default: return is_below16_scalar(units, count, 0xFF00);
+    }
+}
+const bool is_scalar(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return is_scalar16_avx512(units, count);
+    case isa::avx2: return is_scalar16_avx2(units, count);
+    case isa::sse2: return is_scalar16_sse2(units, count);
+#endif
+    default: return is_scalar16_scalar(units, count, false);
+    }
+}
+
+namespace
+{
+void flip_case(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count, const std::uint8_t first) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return flip_case8_avx512(src, dst, count, first);
+    case isa::avx2: return flip_case8_avx2(src, dst, count, first);
+    case isa::sse2: return flip_case8_sse2(src, dst, count, first);
+#endif
+    default: return flip_case8_scalar(src, dst, count, first);
+    }
+}
+void flip_case(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count, const std::uint16_t first) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return flip_case16_avx512(src, dst, count, first);
+    case isa::avx2: return flip_case16_avx2(src, dst, count, first);
+    case isa::sse2: return flip_case16_sse2(src, dst, count, first);
+#endif
+    default: return flip_case16_scalar(src, dst, count, first);
+    }
+}
+}
+void ascii_lowercase(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    flip_case(src, dst, count, std::uint8_t{0x41});
+}
+void ascii_lowercase(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    flip_case(src, dst, count, std::uint16_t{0x41});
+}
+void ascii_uppercase(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    flip_case(src, dst, count, std::uint8_t{0x61});
+}
+void ascii_uppercase(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    flip_case(src, dst, count, std::uint16_t{0x61});
+}
+
+namespace
+{
+const std::size_t find_newline(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return find_newline8_avx512(units, count);
+    case isa::avx2: return find_newline8_avx2(units, count);
+    case isa::sse2: return find_newline8_sse2(units, count);
+#endif
+    default: return find_newline8_scalar(units, count);
+    }
+}
+const std::size_t find_newline(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return find_newline16_avx512(units, count);
+    case isa::avx2: return find_newline16_avx2(units, count);
+    case isa::sse2: return find_newline16_sse2(units, count);
+#endif
+    default: return find_newline16_scalar(units, count);
+    }
+}
+/**
+ * @brief Copies the runs between newlines in bulk. Each newline is dropped, or written as a single U+000A LF with a CR LF pair
+ * counting as one newline. The destination never gets ahead of the source, so the copy can be done in place. */
+template <typename unit_type>
+const std::size_t rewrite_newlines(const unit_type* src, unit_type* dst, const std::size_t count, const bool keep) noexcept
+{
+    std::size_t written = 0;
+    std::size_t i = 0;
+    while (true)
+    {
+        const std::size_t run = find_newline(src + i, count - i);
+        if (run && dst + written != src + i) std::memmove(dst + written, src + i, run * sizeof(unit_type));
+        written += run;
+        i += run;
+        if (i == count) return written;
+        if (src[i] == 0x0D && i + 1 < count && src[i + 1] == 0x0A) ++i;
+        if (keep) dst[written++] = 0x0A;
+        ++i;
+    }
+}
+}
+const std::size_t strip_newlines(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    return rewrite_newlines(src, dst, count, false);
+}
+const std::size_t strip_newlines(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    return rewrite_newlines(src, dst, count, false);
+}
+const std::size_t normalize_newlines(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    return rewrite_newlines(src, dst, count, true);
+}
+const std::size_t normalize_newlines(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    return rewrite_newlines(src, dst, count, true);
+}
+
+namespace
+{
+const std::size_t widen_ascii(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return widen_ascii8_avx512(src, dst, count);
+    case isa::avx2: return widen_ascii8_avx2(src, dst, count);
+    case isa::sse2: return widen_ascii8_sse2(src, dst, count);
+#endif
+    default: return widen_ascii8_scalar(src, dst, count);
+    }
+}
+/**
+ * @brief Decodes the multi byte sequence at the index with the UTF-8 decoder of the WHATWG encoding standard (https://encoding.spec.whatwg.org/#utf-8-decoder).
+ * An invalid or cut off sequence becomes one U+FFFD, and the byte that ended it is left to be decoded again. */
+void decode_utf8_sequence(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count, std::size_t& i, std::size_t& written) noexcept
+{
+    const std::uint8_t lead = src[i];
+    std::size_t needed;
+    std::uint32_t point;
+    std::uint8_t lower = 0x80, upper = 0xBF;
+    if (0xC2 <= lead && lead <= 0xDF) needed = 1, point = lead & 0x1F;
+    else if (0xE0 <= lead && lead <= 0xEF)
+    {
+        needed = 2, point = lead & 0x0F;
+        if (lead == 0xE0) lower = 0xA0;
+        else if (lead == 0xED) upper = 0x9F;
+    }
+    else if (0xF0 <= lead && lead <= 0xF4)
+    {
+        needed = 3, point = lead & 0x07;
+        if (lead == 0xF0) lower = 0x90;
+        else if (lead == 0xF4) upper = 0x8F;
+    }
+    else
+    {
+        dst[written++] = 0xFFFD;
+        ++i;
+        return;
+    }
+    ++i;
+    std::size_t seen = 0;
+    for (; seen < needed && i < count && lower <= src[i] && src[i] <= upper; ++seen, ++i)
+    {
+        point = (point << 6) | (src[i] & 0x3F);
+        lower = 0x80, upper = 0xBF;
+    }
+    if (seen < needed) dst[written++] = 0xFFFD;
+    else if (point < 0x10000) dst[written++] = static_cast<std::uint16_t>(point);
+    else
+    {
+        point -= 0x10000;
+        dst[written++] = static_cast<std::uint16_t>(0xD800 | (point >> 10));
+        dst[written++] = static_cast<std::uint16_t>(0xDC00 | (point & 0x3FF));
+    }
+}
+inline const bool is_continuation(const std::uint8_t byte) noexcept
+{
+    return (byte & 0xC0) == 0x80;
+}
+}
+const std::size_t utf8_decode(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    std::size_t written = 0;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        const std::uint8_t lead = src[i];
+        if (lead < 0x80)
+        {
+            // short ASCII runs between multi byte sequences are copied here, long ones by the vectorized kernel
+            const std::size_t short_end = std::min(count, i + 16);
+            while (i < short_end && src[i] < 0x80) dst[written++] = src[i++];
+            if (i == short_end && i < count)
+            {
+                const std::size_t ascii = widen_ascii(src + i, dst + written, count - i);
+                written += ascii;
+                i += ascii;
+            }
+            continue;
+        }
+
+        // well formed two, three and four byte sequences are decoded directly; anything else goes through the full decoder
+        if (lead >= 0xC2 && lead <= 0xDF && i + 1 < count && is_continuation(src[i + 1]))
+        {
+            dst[written++] = static_cast<std::uint16_t>(((lead & 0x1F) << 6) | (src[i + 1] & 0x3F));
+            i += 2;
+            continue;
+        }
+        if ((lead & 0xF0) == 0xE0 && i + 2 < count && is_continuation(src[i + 1]) && is_continuation(src[i + 2]))
+        {
+            const std::uint32_t point = ((lead & 0x0F) << 12) | ((src[i + 1] & 0x3F) << 6) | (src[i + 2] & 0x3F);
+            if (point >= 0x800 && (point & 0xF800) != 0xD800)
+            {
+                dst[written++] = static_cast<std::uint16_t>(point);
+                i += 3;
+                continue;
+            }
+        }
+        else if ((lead & 0xF8) == 0xF0 && i + 3 < count && is_continuation(src[i + 1]) && is_continuation(src[i + 2]) && is_continuation(src[i + 3]))
+        {
+            const std::uint32_t point = ((lead & 0x07) << 18) | ((src[i + 1] & 0x3F) << 12) | ((src[i + 2] & 0x3F) << 6) | (src[i + 3] & 0x3F);
+            if (point >= 0x10000 && point <= 0x10FFFF)
+            {
+                dst[written++] = static_cast<std::uint16_t>(0xD800 | ((point - 0x10000) >> 10));
+                dst[written++] = static_cast<std::uint16_t>(0xDC00 | (point & 0x3FF));
+                i += 4;
+                continue;
+            }
+        }
+        decode_utf8_sequence(src, dst, count, i, written);
+    }
+    return written;
+}
+
+namespace
+{
+const std::size_t copy_ascii(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return copy_ascii8_avx512(src, dst, count);
+    case isa::avx2: return copy_ascii8_avx2(src, dst, count);
+    case isa::sse2: return copy_ascii8_sse2(src, dst, count);
+#endif
+    default: return copy_ascii8_scalar(src, dst, count);
+    }
+}
+const std::size_t copy_ascii(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return narrow_ascii16_avx512(src, dst, count);
+    case isa::avx2: return narrow_ascii16_avx2(src, dst, count);
+    case isa::sse2: return narrow_ascii16_sse2(src, dst, count);
+#endif
+    default: return narrow_ascii16_scalar(src, dst, count);
+    }
+}
+/** @brief Encodes the code units as UTF-8, copying ASCII runs with the vectorized kernels. A lone surrogate is encoded as U+FFFD. */
+template <typename unit_type>
+const std::size_t encode_utf8(const unit_type* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    std::size_t written = 0;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        std::uint32_t point = src[i];
+        if (point < 0x80)
+        {
+            const std::size_t short_end = std::min(count, i + 16);
+            while (i < short_end && src[i] < 0x80) dst[written++] = static_cast<std::uint8_t>(src[i++]);
+            if (i == short_end && i < count)
+            {
+                const std::size_t ascii = copy_ascii(src + i, dst + written, count - i);
+                written += ascii;
+                i += ascii;
+            }
+            continue;
+        }
+        ++i;
+        if (point < 0x800)
+        {
+            dst[written++] = static_cast<std::uint8_t>(0xC0 | (point >> 6));
+            dst[written++] = static_cast<std::uint8_t>(0x80 | (point & 0x3F));
+            continue;
+        }
+        if ((point & 0xF800) == 0xD800)
+        {
+            if (point <= 0xDBFF && i < count && (src[i] & 0xFC00) == 0xDC00)
+            {
+                point = 0x10000 + ((point - 0xD800) << 10) + (src[i++] - 0xDC00);
+                dst[written++] = static_cast<std::uint8_t>(0xF0 | (point >> 18));
+                dst[written++] = static_cast<std::uint8_t>(0x80 | ((point >> 12) & 0x3F));
+                dst[written++] = static_cast<std::uint8_t>(0x80 | ((point >> 6) & 0x3F));
+                dst[written++] = static_cast<std::uint8_t>(0x80 | (point & 0x3F));
+                continue;
+            }
+            point = 0xFFFD;
+        }
+        dst[written++] = static_cast<std::uint8_t>(0xE0 | (point >> 12));
+        dst[written++] = static_cast<std::uint8_t>(0x80 | ((point >> 6) & 0x3F));
+        dst[written++] = static_cast<std::uint8_t>(0x80 | (point & 0x3F));
+    }
+    return written;
+}
+}
+const std::size_t utf8_size(const std::uint8_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return utf8_size8_avx512(units, count);
+    case isa::avx2: return utf8_size8_avx2(units, count);
+    case isa::sse2: return utf8_size8_sse2(units, count);
+#endif
+    default: return utf8_size8_scalar(units, count);
+    }
+}
+const std::size_t utf8_size(const std::uint16_t* units, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return utf8_size16_avx512(units, count);
+    case isa::avx2: return utf8_size16_avx2(units, count);
+    case isa::sse2: return utf8_size16_sse2(units, count);
+#endif
+    default: return utf8_size16_scalar(units, count, false);
+    }
+}
+const std::size_t utf8_encode(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    return encode_utf8(src, dst, count);
+}
+const std::size_t utf8_encode(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    return encode_utf8(src, dst, count);
+}
+void widen(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return widen8_avx512(src, dst, count);
+    case isa::avx2: return widen8_avx2(src, dst, count);
+    case isa::sse2: return widen8_sse2(src, dst, count);
+#endif
+    default: return widen8_scalar(src, dst, count);
+    }
+}
+void narrow(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return narrow16_avx512(src, dst, count);
+    case isa::avx2: return narrow16_avx2(src, dst, count);
+    case isa::sse2: return narrow16_sse2(src, dst, count);
+#endif
+    default: return narrow16_scalar(src, dst, count);
+    }
+}
+
+const std::size_t base64_encode(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst) noexcept
+{
+    std::size_t i;
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    // SSE2 has no byte shuffle, so the vectorized version needs AVX2
+    if (active_isa() >= isa::avx2) i = base64_encode_avx2(src, count, dst);
+    else
+#endif
+    i = base64_encode_scalar(src, count, dst);
+    dst += i / 3 * 4;
+    if (count - i == 1)
+    {
+        dst[0] = base64_alphabet[src[i] >> 2];
+        dst[1] = base64_alphabet[(src[i] & 0x03) << 4];
+        dst[2] = dst[3] = '=';
+    }
+    else if (count - i == 2)
+    {
+        dst[0] = base64_alphabet[src[i] >> 2];
+        dst[1] = base64_alphabet[((src[i] & 0x03) << 4) | (src[i + 1] >> 4)];
+        dst[2] = base64_alphabet[(src[i + 1] & 0x0F) << 2];
+        dst[3] = '=';
+    }
+    return (count + 2) / 3 * 4;
+}
+const bool base64_decode(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept
+{
+    std::size_t i = 0;
+    while (i < count)
+    {
+        std::size_t stop = i + 32;
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+        // whole groups go through the vectorized version; the group it stops at, such as one split by a line break, is decoded one character at a time
+        if (active_isa() >= isa::avx2)
+        {
+            if (!(sextets & 3) && !padding)
+            {
+                const std::size_t decoded = base64_decode_avx2(src + i, count - i, dst + written);
+                written += decoded / 4 * 3;
+                sextets += static_cast<std::uint32_t>(decoded);
+                i += decoded;
+            }
+            stop = i + 1;
+        }
+#endif
+        if (!base64_decode_scalar(src, count, i, stop, dst, written, bits, sextets, padding)) return false;
+    }
+    return true;
+}
+const bool base64_decode(const std::uint16_t* src, const std::size_t count, std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept
+{
+    std::size_t i = 0;
+    return base64_decode_scalar(src, count, i, count, dst, written, bits, sextets, padding);
+}
+const bool base64_finish(std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept
+{
+    // padding is only allowed to fill the last group, and a group of one sextet holds no byte
+    const std::uint32_t partial = sextets & 3;
+    const bool valid = padding ? padding <= 2 && partial + padding == 4 : partial != 1;
+    if (valid && partial == 2) dst[written++] = static_cast<std::uint8_t>(bits >> 4);
+    else if (valid && partial == 3)
+    {
+        dst[written++] = static_cast<std::uint8_t>(bits >> 10);
+        dst[written++] = static_cast<std::uint8_t>(bits >> 2);
+    }
+    bits = sextets = padding = 0;
+    return valid;
+}
+
+//----------//
+
+namespace
+{
+const json_block classify_json(const std::uint8_t* src) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return classify_json_avx512(src);
+    case isa::avx2: return classify_json_avx2(src);
+    case isa::sse2: return classify_json_sse2(src);
+#endif
+    default: return classify_json_scalar(src);
+    }
+}
+/** @brief Returns a mask of the bytes escaped by a backslash, carrying an escape that crosses into the next block in escaped. */
+inline const std::uint64_t find_json_escaped(const std::uint64_t backslashes, std::uint64_t& escaped) noexcept
+{
+    // a run of backslashes escapes every other byte from its start; adding the odd starts flips the runs that start on an odd bit
+    constexpr std::uint64_t even_bits = 0x5555555555555555;
+    const std::uint64_t backslash = backslashes & ~escaped;
+    const std::uint64_t follows_escape = backslash << 1 | escaped;
+    const std::uint64_t odd_starts = backslash & ~even_bits & ~follows_escape;
+    const std::uint64_t even_starts = odd_starts + backslash;
+    escaped = even_starts < backslash;
+    return (even_bits ^ (even_starts << 1)) & follows_escape;
+}
+/** @brief Sets each bit to the parity of the bits at and below it, which turns the quotes into a mask from each opening quote up to its closing quote. */
+inline const std::uint64_t prefix_xor(std::uint64_t bits) noexcept
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+}
+void json_structural_index(const std::uint8_t* src, const std::size_t count, const std::size_t offset, std::uint32_t* dst, std::size_t& written, std::uint64_t& escaped, std::uint64_t& in_string, std::uint64_t& after_scalar) noexcept
+{
+    alignas(64) std::uint8_t tail[64];
+    for (std::size_t i = 0; i < count; i += 64)
+    {
+        // the last partial block is padded with spaces, which are never structural
+        const std::uint8_t* units = src + i;
+        if (count - i < 64)
+        {
+            std::memset(tail, 0x20, sizeof(tail));
+            std::memcpy(tail, units, count - i);
+            units = tail;
+        }
+        const json_block block = classify_json(units);
+        const std::uint64_t quote = block.quote & ~find_json_escaped(block.backslash, escaped);
+        const std::uint64_t string = prefix_xor(quote) ^ in_string;
+        in_string = static_cast<std::uint64_t>(static_cast<std::int64_t>(string) >> 63);
+        // a scalar token starts at any byte other than an operator or whitespace that does not follow one of its own
+        const std::uint64_t scalar = ~(block.op | block.space);
+        const std::uint64_t unquoted_scalar = scalar & ~quote;
+        const std::uint64_t scalar_start = scalar & ~(unquoted_scalar << 1 | after_scalar);
+        after_scalar = unquoted_scalar >> 63;
+        // the string mask covers each opening quote but not the closing one; flipping it by the quotes keeps the opening quotes only
+        std::uint64_t structurals = (block.op | scalar_start) & ~(string ^ quote);
+        while (structurals)
+        {
+            dst[written++] = static_cast<std::uint32_t>(offset + i + std::countr_zero(structurals));
+            structurals &= structurals - 1;
+        }
+    }
+}
+const std::size_t find_json_special(const std::uint8_t* src, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return find_json_special_avx512(src, count);
+    case isa::avx2: return find_json_special_avx2(src, count);
+    case isa::sse2: return find_json_special_sse2(src, count);
+#endif
+    default: return find_json_special_scalar(src, count);
+    }
+}
+const std::size_t find_json_special(const std::uint16_t* src, const std::size_t count) noexcept
+{
+    switch (active_isa())
+    {
+#ifdef SOFTLOQ_WHATWG_INFRA_KERNEL_X86
+    case isa::avx512: return find_json_special_avx512(src, count);
+    case isa::avx2: return find_json_special_avx2(src, count);
+    case isa::sse2: return find_json_special_sse2(src, count);
+#endif
+    default: return find_json_special_scalar(src, count);
+    }
+}
+}
\ No newline at end of file
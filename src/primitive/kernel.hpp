@@ -0,0 +1,105 @@
+/**
+ * @file kernel.hpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Declaration of the vectorized code unit kernels used by the WHATWG infra string and JSON classes.
+ * @version 1.0.0 */
+
+#ifndef SOFTLOQ_WHATWG_INFRA_PRIMITIVE_KERNEL_HPP
+#define SOFTLOQ_WHATWG_INFRA_PRIMITIVE_KERNEL_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Raw code unit kernels. Each kernel has a scalar version and, on x86, SSE2, AVX2 and AVX-512 versions.
+ * The widest version the processor supports is picked once at runtime. */
+namespace softloq::whatwg::kernel
+{
+/** @brief Instruction sets the kernels are compiled for. */
+enum class isa { scalar, sse2, avx2, avx512 };
+
+/** @brief Returns the instruction set the kernels dispatch to. */
+const isa active_isa() noexcept;
+
+/** @brief Checks if every one byte code unit is within the range of U+0000 NULL to U+007F DELETE, inclusive. */
+const bool is_ascii(const std::uint8_t* units, const std::size_t count) noexcept;
+/** @brief Checks if every two byte code unit is within the range of U+0000 NULL to U+007F DELETE, inclusive. */
+const bool is_ascii(const std::uint16_t* units, const std::size_t count) noexcept;
+/** @brief Checks if every two byte code unit is within the range of U+0000 NULL to U+00FF (ÿ), inclusive. */
+const bool is_isomorphic(const std::uint16_t* units, const std::size_t count) noexcept;
+/** @brief Checks if every surrogate among the two byte code units is part of a leading and trailing surrogate pair. */
+const bool is_scalar(const std::uint16_t* units, const std::size_t count) noexcept;
+
+/** @brief Writes the one byte code units with U+0041 (A) to U+005A (Z) mapped to U+0061 (a) to U+007A (z). The source and destination may be the same buffer. */
+void ascii_lowercase(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the two byte code units with U+0041 (A) to U+005A (Z) mapped to U+0061 (a) to U+007A (z). The source and destination may be the same buffer. */
+void ascii_lowercase(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the one byte code units with U+0061 (a) to U+007A (z) mapped to U+0041 (A) to U+005A (Z). The source and destination may be the same buffer. */
+void ascii_uppercase(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the two byte code units with U+0061 (a) to U+007A (z) mapped to U+0041 (A) to U+005A (Z). The source and destination may be the same buffer. */
+void ascii_uppercase(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+
+/** @brief Writes the one byte code units without U+000A LF and U+000D CR. Returns the number of code units written. The source and destination may be the same buffer. */
+const std::size_t strip_newlines(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the two byte code units without U+000A LF and U+000D CR. Returns the number of code units written. The source and destination may be the same buffer. */
+const std::size_t strip_newlines(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the one byte code units with every U+000D CR U+000A LF pair and lone U+000D CR replaced by U+000A LF. Returns the number of code units written. The source and destination may be the same buffer. */
+const std::size_t normalize_newlines(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+/** @brief Writes the two byte code units with every U+000D CR U+000A LF pair and lone U+000D CR replaced by U+000A LF. Returns the number of code units written. The source and destination may be the same buffer. */
+const std::size_t normalize_newlines(const std::uint16_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+
+/**
+ * @brief Decodes UTF-8 bytes into two byte code units, replacing each invalid or cut off sequence with U+FFFD as the WHATWG encoding standard does.
+ * A byte order mark is decoded like any other code point. The destination needs room for count code units.
+ * Returns the number of code units written. */
+const std::size_t utf8_decode(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+
+/** @brief Counts the bytes the UTF-8 encoding of the one byte code units takes. */
+const std::size_t utf8_size(const std::uint8_t* units, const std::size_t count) noexcept;
+/** @brief Counts the bytes the UTF-8 encoding of the two byte code units takes. A lone surrogate takes the three bytes of U+FFFD. */
+const std::size_t utf8_size(const std::uint16_t* units, const std::size_t count) noexcept;
+/** @brief UTF-8 encodes the one byte code units. The destination needs room for utf8_size bytes. Returns the number of bytes written. */
+const std::size_t utf8_encode(const std::uint8_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+/**
+ * @brief UTF-8 encodes the two byte code units, joining surrogate pairs and replacing each lone surrogate with U+FFFD.
+ * The destination needs room for utf8_size bytes. Returns the number of bytes written. */
+const std::size_t utf8_encode(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+
+/** @brief Widens one byte code units into two byte code units. */
+void widen(const std::uint8_t* src, std::uint16_t* dst, const std::size_t count) noexcept;
+/**
+ * @brief Narrows two byte code units into one byte code units, keeping the low byte of any unit above 0xFF.
+ * The source and destination may be the same buffer. */
+void narrow(const std::uint16_t* src, std::uint8_t* dst, const std::size_t count) noexcept;
+
+/** @brief Base64 encodes bytes with padding. The destination needs room for (count + 2) / 3 * 4 characters. Returns the number of characters written. */
+const std::size_t base64_encode(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst) noexcept;
+/** @brief Returns the room the destination of base64_decode needs for count characters. */
+constexpr std::size_t base64_decode_capacity(const std::size_t count) noexcept
+{
+    return (count + 3) / 4 * 3 + 8;
+}
+/**
+ * @brief Forgiving-base64 decodes one chunk of characters (https://infra.spec.whatwg.org/#forgiving-base64-decode), skipping ASCII whitespace.
+ * A partial group of sextets is carried between chunks in bits and sextets, and padding counts the U+003D (=) seen; all three start at 0.
+ * Adds the bytes written to written. Returns false if the chunk holds a character outside the alphabet or an alphabet character after padding. */
+const bool base64_decode(const std::uint8_t* src, const std::size_t count, std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept;
+const bool base64_decode(const std::uint16_t* src, const std::size_t count, std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept;
+/** @brief Ends base64 decoding, writing the up to two bytes of a partial group. Returns false if the padding or the partial group is invalid. Resets the state. */
+const bool base64_finish(std::uint8_t* dst, std::size_t& written, std::uint32_t& bits, std::uint32_t& sextets, std::uint32_t& padding) noexcept;
+
+/**
+ * @brief Indexes the structural bytes of one chunk of UTF-8 JSON text: the operators {}[],: outside of strings, the opening quote of each string,
+ * and the first byte of every other token. Every chunk but the last is a multiple of 64 bytes, and offset is where the chunk starts in the text.
+ * Escapes, strings and tokens that cross into the next chunk are carried in escaped, in_string and after_scalar, which all start at 0; in_string
+ * is left nonzero if the text ends inside a string. Writes the offsets in order at dst + written, which needs room for count more offsets,
+ * and adds their number to written. */
+void json_structural_index(const std::uint8_t* src, const std::size_t count, const std::size_t offset, std::uint32_t* dst, std::size_t& written, std::uint64_t& escaped, std::uint64_t& in_string, std::uint64_t& after_scalar) noexcept;
+/**
+ * @brief Returns the index of the first U+0022 ("), U+005C (\) or C0 control code unit, or count if there is none.
+ * These are the code units that end a plain run of a JSON string when it is parsed, and the ones that are escaped when it is serialized. */
+const std::size_t find_json_special(const std::uint8_t* src, const std::size_t count) noexcept;
+const std::size_t find_json_special(const std::uint16_t* src, const std::size_t count) noexcept;
+}
+
+#endif
\ No newline at end of file
@@ -5,28 +5,376 @@
  * @version 1.0.0 */
 
 #include "softloq/whatwg/infra/primitive/string.hpp"
+#include "kernel.hpp"
 
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <cstring>
+#include <new>
+#include <memory>
 
 namespace softloq::whatwg
 {
+namespace
+{
+// raw code unit helpers //
+
+inline const bool is_leading_surrogate_unit(const std::uint16_t unit) noexcept
+{
+    return 0xD800 <= unit && unit <= 0xDBFF;
+}
+inline const bool is_trailing_surrogate_unit(const std::uint16_t unit) noexcept
+{
+    return 0xDC00 <= unit && unit <= 0xDFFF;
+}
+inline const std::uint16_t unit_at(const void* units, const bool wide, const std::size_t index) noexcept
+{
+    return wide ? static_cast<const std::uint16_t*>(units)[index] : static_cast<const std::uint8_t*>(units)[index];
+}
+/** @brief Returns 2 if a surrogate pair starts at the index, 1 otherwise. */
+inline const std::size_t point_width_at(const void* units, const std::size_t length, const bool wide, const std::size_t index) noexcept
+{
+    return wide && index + 1 < length
+        && is_leading_surrogate_unit(static_cast<const std::uint16_t*>(units)[index])
+        && is_trailing_surrogate_unit(static_cast<const std::uint16_t*>(units)[index + 1]) ? 2 : 1;
+}
+/** @brief Returns 3 if the bytes start with a UTF-8 byte order mark, 0 otherwise. */
+inline const std::size_t utf8_bom_size(const std::uint8_t* bytes, const std::size_t count) noexcept
+{
+    return count >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF ? 3 : 0;
+}
+
+//------------------------//
+}
+
+// code unit view //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator::const_iterator() noexcept
+: units(nullptr), wide(false), pos(0)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator::const_iterator(const void* units, const bool wide, const difference_type pos) noexcept
+: units(units), wide(wide), pos(pos)
+{
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator::reference infra_string::code_unit_view::const_iterator::operator*() const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, pos)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator::reference infra_string::code_unit_view::const_iterator::operator[](const difference_type n) const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, pos + n)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator& infra_string::code_unit_view::const_iterator::operator++() noexcept
+{
+    ++pos;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::const_iterator::operator++(int) noexcept
+{
+    const_iterator it{*this};
+    ++pos;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator& infra_string::code_unit_view::const_iterator::operator--() noexcept
+{
+    --pos;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::const_iterator::operator--(int) noexcept
+{
+    const_iterator it{*this};
+    --pos;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator& infra_string::code_unit_view::const_iterator::operator+=(const difference_type n) noexcept
+{
+    pos += n;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator& infra_string::code_unit_view::const_iterator::operator-=(const difference_type n) noexcept
+{
+    pos -= n;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::const_iterator::operator+(const difference_type n) const noexcept
+{
+    return const_iterator{units, wide, pos + n};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::const_iterator::operator-(const difference_type n) const noexcept
+{
+    return const_iterator{units, wide, pos - n};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator::difference_type infra_string::code_unit_view::const_iterator::operator-(const const_iterator& b) const noexcept
+{
+    return pos - b.pos;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::code_unit_view::const_iterator::operator==(const const_iterator& b) const noexcept
+{
+    return pos == b.pos;
+}
+SOFTLOQ_WHATWG_INFRA_API std::strong_ordering infra_string::code_unit_view::const_iterator::operator<=>(const const_iterator& b) const noexcept
+{
+    return pos <=> b.pos;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator operator+(const infra_string::code_unit_view::const_iterator::difference_type n, const infra_string::code_unit_view::const_iterator& it) noexcept
+{
+    return it + n;
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::code_unit_view() noexcept
+: units(nullptr), length(0), wide(false)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::code_unit_view(const void* units, const size_type length, const bool wide) noexcept
+: units(units), length(length), wide(wide)
+{
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::begin() const noexcept
+{
+    return const_iterator{units, wide, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::cbegin() const noexcept
+{
+    return const_iterator{units, wide, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::end() const noexcept
+{
+    return const_iterator{units, wide, static_cast<const_iterator::difference_type>(length)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_iterator infra_string::code_unit_view::cend() const noexcept
+{
+    return const_iterator{units, wide, static_cast<const_iterator::difference_type>(length)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_reverse_iterator infra_string::code_unit_view::rbegin() const noexcept
+{
+    return const_reverse_iterator{end()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_reverse_iterator infra_string::code_unit_view::crbegin() const noexcept
+{
+    return const_reverse_iterator{end()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_reverse_iterator infra_string::code_unit_view::rend() const noexcept
+{
+    return const_reverse_iterator{begin()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_view::const_reverse_iterator infra_string::code_unit_view::crend() const noexcept
+{
+    return const_reverse_iterator{begin()};
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::code_unit_view::front() const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, 0)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::code_unit_view::back() const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, length - 1)};
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_string::code_unit_view::size_type infra_string::code_unit_view::size() const noexcept
+{
+    return length;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::code_unit_view::empty() const noexcept
+{
+    return !length;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::code_unit_view::operator[](const size_type index) const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, index)};
+}
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::code_unit_view::is_wide() const noexcept
+{
+    return wide;
+}
+SOFTLOQ_WHATWG_INFRA_API const std::uint8_t* infra_string::code_unit_view::latin1_data() const noexcept
+{
+    return static_cast<const std::uint8_t*>(units);
+}
+SOFTLOQ_WHATWG_INFRA_API const std::uint16_t* infra_string::code_unit_view::utf16_data() const noexcept
+{
+    return static_cast<const std::uint16_t*>(units);
+}
+
+//----------------//
+
+// code point view //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator::const_iterator() noexcept
+: units(nullptr), length(0), wide(false), pos(0)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator::const_iterator(const void* units, const size_type length, const bool wide, const size_type pos) noexcept
+: units(units), length(length), wide(wide), pos(pos)
+{
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator::reference infra_string::code_point_view::const_iterator::operator*() const noexcept
+{
+    const std::uint32_t unit = unit_at(units, wide, pos);
+    if (point_width_at(units, length, wide, pos) == 2)
+        return infra_code_point{((unit - 0xD800) << 10) + (unit_at(units, wide, pos + 1) - 0xDC00) + 0x10000};
+    return infra_code_point{unit};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator& infra_string::code_point_view::const_iterator::operator++() noexcept
+{
+    pos += point_width_at(units, length, wide, pos);
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::const_iterator::operator++(int) noexcept
+{
+    const_iterator it{*this};
+    ++*this;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator& infra_string::code_point_view::const_iterator::operator--() noexcept
+{
+    if (pos >= 2 && point_width_at(units, length, wide, pos - 2) == 2) pos -= 2;
+    else --pos;
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::const_iterator::operator--(int) noexcept
+{
+    const_iterator it{*this};
+    --*this;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::code_point_view::const_iterator::operator==(const const_iterator& b) const noexcept
+{
+    return pos == b.pos;
+}
+
+SOFTLOQ_WHATWG_INFRA_API const infra_string::code_point_view::size_type infra_string::code_point_view::const_iterator::position() const noexcept
+{
+    return pos;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_string::code_point_view::size_type infra_string::code_point_view::const_iterator::width() const noexcept
+{
+    return point_width_at(units, length, wide, pos);
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::code_point_view() noexcept
+: units(nullptr), length(0), wide(false)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::code_point_view(const void* units, const size_type length, const bool wide) noexcept
+: units(units), length(length), wide(wide)
+{
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::begin() const noexcept
+{
+    return const_iterator{units, length, wide, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::cbegin() const noexcept
+{
+    return const_iterator{units, length, wide, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::end() const noexcept
+{
+    return const_iterator{units, length, wide, length};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_iterator infra_string::code_point_view::cend() const noexcept
+{
+    return const_iterator{units, length, wide, length};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_reverse_iterator infra_string::code_point_view::rbegin() const noexcept
+{
+    return const_reverse_iterator{end()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_reverse_iterator infra_string::code_point_view::crbegin() const noexcept
+{
+    return const_reverse_iterator{end()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_reverse_iterator infra_string::code_point_view::rend() const noexcept
+{
+    return const_reverse_iterator{begin()};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_view::const_reverse_iterator infra_string::code_point_view::crend() const noexcept
+{
+    return const_reverse_iterator{begin()};
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string::code_point_view::front() const noexcept
+{
+    return *begin();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string::code_point_view::back() const noexcept
+{
+    return *--end();
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_string::code_point_view::size_type infra_string::code_point_view::size() const noexcept
+{
+    if (!wide) return length;
+    // every trailing surrogate directly preceded by a leading surrogate shares its code point with it
+    const std::uint16_t* first = static_cast<const std::uint16_t*>(units);
+    size_type count = length;
+    for (size_type i = 0; i + 1 < length; ++i)
+        if (is_leading_surrogate_unit(first[i]) && is_trailing_surrogate_unit(first[i + 1])) --count, ++i;
+    return count;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::code_point_view::empty() const noexcept
+{
+    return !length;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string::code_point_view::operator[](const size_type index) const noexcept
+{
+    if (!wide) return infra_code_point{static_cast<const std::uint8_t*>(units)[index]};
+    return *std::next(begin(), index);
+}
+
+//-----------------//
+
 // constructors //
 
-SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string() noexcept {}
+SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string() noexcept
+: length(0), wide(false), is_local(true)
+{
+}
 SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const std::initializer_list<infra_code_unit>& values) noexcept
+: infra_string()
 {
-    for (const auto& value: values) push_code_point(infra_code_point{value});
+    reserve(values.size());
+    for (const auto& value: values) push_code_unit(value);
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const std::string& values) noexcept
+: infra_string()
 {
-    std::transform(values.cbegin(), values.cend(), std::back_inserter(units), [](const char c) { return infra_code_unit{static_cast<std::uint8_t>(c)}; });
-    for (const auto& value: values) push_code_point(infra_code_point{static_cast<std::uint8_t>(value)});
+    append_units(reinterpret_cast<const std::uint8_t*>(values.data()), values.size());
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const std::u8string& values) noexcept
+: infra_string()
+{
+    decode_utf8(reinterpret_cast<const std::uint8_t*>(values.data()), values.size());
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const infra_string_view& values) noexcept
+: infra_string()
+{
+    push_back(values);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const infra_string& src) noexcept
+: infra_string()
+{
+    if (src.wide) append_units(src.utf16_data(), src.length);
+    else append_units(src.latin1_data(), src.length);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(infra_string&& src) noexcept
+: length(src.length), wide(src.wide), is_local(src.is_local)
+{
+    if (is_local) std::memcpy(storage.local, src.storage.local, length << wide);
+    else storage.heap = src.storage.heap;
+    src.length = 0;
+    src.wide = false;
+    src.is_local = true;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::~infra_string() noexcept
+{
+    if (!is_local) ::operator delete(storage.heap.data);
 }
-SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(const infra_string& src) noexcept : units(src.units), points(src.points) {}
-SOFTLOQ_WHATWG_INFRA_API infra_string::infra_string(infra_string&& src) noexcept : units(std::move(src.units)), points(std::move(src.points)) {}
-SOFTLOQ_WHATWG_INFRA_API infra_string::~infra_string() noexcept {}
 
 //--------------//
 
@@ -34,22 +382,38 @@ SOFTLOQ_WHATWG_INFRA_API infra_string::~infra_string() noexcept {}
 
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator=(const std::string& values) noexcept
 {
-    units.clear();
-    std::transform(values.cbegin(), values.cend(), std::back_inserter(units), [](const char c) { return infra_code_unit{static_cast<std::uint8_t>(c)}; });
-    points.clear();
-    for (auto value: values) push_code_point(infra_code_point{static_cast<std::uint8_t>(value)});
+    clear();
+    append_units(reinterpret_cast<const std::uint8_t*>(values.data()), values.size());
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator=(const infra_string_view& values) noexcept
+{
+    // clearing would discard the units of a view into this string
+    if (overlaps(values)) return *this = infra_string{values};
+    clear();
+    push_back(values);
     return *this;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator=(const infra_string& src) noexcept
 {
-    units = src.units;
-    points = src.points;
+    if (this == &src) return *this;
+    clear();
+    if (src.wide) append_units(src.utf16_data(), src.length);
+    else append_units(src.latin1_data(), src.length);
     return *this;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator=(infra_string&& src) noexcept
 {
-    units = std::move(src.units);
-    points = std::move(src.points);
+    if (this == &src) return *this;
+    if (!is_local) ::operator delete(storage.heap.data);
+    length = src.length;
+    wide = src.wide;
+    is_local = src.is_local;
+    if (is_local) std::memcpy(storage.local, src.storage.local, length << wide);
+    else storage.heap = src.storage.heap;
+    src.length = 0;
+    src.wide = false;
+    src.is_local = true;
     return *this;
 }
 
@@ -59,396 +423,313 @@ SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator=(infra_string&& sr
 
 SOFTLOQ_WHATWG_INFRA_API infra_string::iterator infra_string::begin()
 {
-    return units.begin();
+    return code_units().begin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_iterator infra_string::begin() const
 {
-    return units.begin();
+    return code_units().begin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_iterator infra_string::cbegin() const noexcept
 {
-    return units.cbegin();
+    return code_units().cbegin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::iterator infra_string::end()
 {
-    return units.end();
+    return code_units().end();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_iterator infra_string::end() const
 {
-    return units.end();
+    return code_units().end();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_iterator infra_string::cend() const noexcept
-{ 
-    return units.cend();
+{
+    return code_units().cend();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::reverse_iterator infra_string::rbegin()
 {
-    return units.rbegin();
+    return code_units().rbegin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_reverse_iterator infra_string::rbegin() const
 {
-    return units.rbegin();
+    return code_units().rbegin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_reverse_iterator infra_string::crbegin() const noexcept
 {
-    return units.crbegin();
+    return code_units().crbegin();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::reverse_iterator infra_string::rend()
 {
-    return units.rend();
+    return code_units().rend();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_reverse_iterator infra_string::rend() const
 {
-    return units.rend();
+    return code_units().rend();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::const_reverse_iterator infra_string::crend() const noexcept
 {
-    return units.crend();
+    return code_units().crend();
 }
 
 //---------------------------//
 
 // WHATWG string member functions //
 
-SOFTLOQ_WHATWG_INFRA_API const infra_string::code_unit_sequence_type& infra_string::code_units() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_sequence_type infra_string::code_units() const noexcept
 {
-    return units;
+    return code_unit_view{buffer(), length, wide};
 }
-SOFTLOQ_WHATWG_INFRA_API const infra_string::code_point_sequence_type& infra_string::code_points() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_sequence_type infra_string::code_points() const noexcept
 {
-    return points;
+    return code_point_view{buffer(), length, wide};
 }
 
 SOFTLOQ_WHATWG_INFRA_API std::string infra_string::code_unit_str() const noexcept
 {
-    std::stringstream out;
-    for (code_unit_sequence_type::size_type i = 0; i < units.size(); ++i)
-    {
-        out << units[i];
-        if (i != units.size() - 1) out << " ";
-    }
-    return out.str();
+    return infra_string_view{*this}.code_unit_str();
 }
 SOFTLOQ_WHATWG_INFRA_API std::string infra_string::code_point_str() const noexcept
 {
-    std::stringstream out;
-    for (code_point_sequence_type::size_type i = 0; i < points.size(); ++i)
-    {
-        out << points[i];
-        if (i != points.size() - 1) out << " ";
-    }
-    return out.str();
+    return infra_string_view{*this}.code_point_str();
 }
 SOFTLOQ_WHATWG_INFRA_API std::string infra_string::quoted_str() const noexcept
 {
-    std::string quoted = "\"";
-    for (const auto& point: points)
-    {
-        if (point <= 0x007F)
-            quoted += static_cast<char>(point);
-        else if (point <= 0x07FF)
-        {
-            quoted += static_cast<char>(0xC0 + (0x1F & (point >> 6)));
-            quoted += static_cast<char>(0x80 + (0x3F & point));
-        }
-        else if (point <= 0xFFFF)
-        {
-            quoted += static_cast<char>(0xE0 + (0x0F & (point >> 12)));
-            quoted += static_cast<char>(0x80 + (0x3F & (point >> 6)));
-            quoted += static_cast<char>(0x80 + (0x3F & point));
-        }
-        else if (point <= 0x10FFFF)
-        {
-            quoted += static_cast<char>(0xF0 + (0x07 & (point >> 18)));
-            quoted += static_cast<char>(0x80 + (0x3F & (point >> 12)));
-            quoted += static_cast<char>(0x80 + (0x3F & (point >> 6)));
-            quoted += static_cast<char>(0x80 + (0x3F & point));
-        }
-    }
-    quoted += "\"";
-    return quoted;
+    return infra_string_view{*this}.quoted_str();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::scalar() const noexcept
 {
+    // one byte strings cannot contain surrogates
+    if (!wide) return *this;
     infra_string string;
-    for (const auto& unit: units)
-    {
-        if (string.units.size() && unit.is_surrogate() && string.points.back().is_surrogate())
-        {
-            if (!(string.points.back().is_leading_surrogate() && unit.is_trailing_surrogate()))
-            {
-                string.units.back() = {0xFFFD};
-                string.points.back() = {0xFFFD};
-            }
-        }
-        string.push_code_unit(unit);
-        string.push_code_point(unit);
-    }
-    if (string.points.size() && string.points.back().is_surrogate())
-    {
-        string.units.back() = {0xFFFD};
-        string.points.back() = {0xFFFD};
-    }
+    string.reserve(length);
+    for (const auto point: code_points()) string.push_code_unit(point.is_surrogate() ? infra_code_point{0xFFFD} : point);
     return string;
 }
 
 SOFTLOQ_WHATWG_INFRA_API infra_string::size_type infra_string::size() const noexcept
 {
-    return units.size();
+    return length;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::code_unit_sequence_type::size_type infra_string::code_unit_size() const noexcept
 {
-    return units.size();
+    return length;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::code_point_sequence_type::size_type infra_string::code_point_size() const noexcept
 {
-    return points.size();
+    return code_points().size();
 }
 
 SOFTLOQ_WHATWG_INFRA_API const bool infra_string::is_ascii() const noexcept
 {
-    for (const auto& point: points) if (!point.is_ascii()) return false;
-    return true;
+    return infra_string_view{*this}.is_ascii();
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_string::is_isomorphic() const noexcept
 {
-    for (const auto& point: points) if (point > 0xFF) return false;
-    return true;
+    return infra_string_view{*this}.is_isomorphic();
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_string::is_scalar() const noexcept
 {
-    for (const auto& point: points) if (!point.is_scalar()) return false;
-    return true;
+    return infra_string_view{*this}.is_scalar();
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::is_wide() const noexcept
+{
+    return wide;
 }
 
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::code_unit_substr(const size_type start, const size_type length) const noexcept
 {
-    infra_string string;
-    if (start >= units.size()) return string;
-    for (size_type i = start; i - start < length && i < units.size(); ++i)
-    {
-        string.push_code_unit(units[i]);
-        string.push_code_point(units[i]);
-    }
-    return string;
+    // a wide string yields a one byte substring if the substring allows it
+    return infra_string{infra_string_view{*this}.code_unit_substr(start, length)};
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::code_unit_substr(const size_type start) const noexcept
 {
-    return code_unit_substr(start, units.size());
+    return code_unit_substr(start, length);
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::code_point_substr(const size_type start, const size_type length) const noexcept
 {
-    infra_string string;
-    if (start >= points.size()) return string;
-    for (size_type i = start; i - start < length && i < points.size(); ++i)
-    {
-        string.push_code_unit(points[i]);
-        string.push_code_point(points[i]);
-    }
-    return string;
+    return infra_string{infra_string_view{*this}.code_point_substr(start, length)};
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::code_point_substr(const size_type start) const noexcept
 {
-    return code_point_substr(start, points.size());
+    return code_point_substr(start, length);
 }
 
 SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_string::byte_encoding() const noexcept
 {
-    return infra_byte_sequence{};
+    return infra_string_view{*this}.byte_encoding();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::size_type infra_string::byte_encoding(std::uint8_t* bytes) const noexcept
+{
+    return infra_string_view{*this}.byte_encoding(bytes);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string::size_type infra_string::byte_encoding_size() const noexcept
+{
+    return infra_string_view{*this}.byte_encoding_size();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::utf8_decode(const infra_byte_sequence& bytes) noexcept
+{
+    // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+    const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(std::to_address(bytes.cbegin()));
+    const size_type bom = utf8_bom_size(data, bytes.size());
+    infra_string string;
+    string.decode_utf8(data + bom, bytes.size() - bom);
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::utf8_decode(const std::string& bytes) noexcept
+{
+    const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(bytes.data());
+    const size_type bom = utf8_bom_size(data, bytes.size());
+    infra_string string;
+    string.decode_utf8(data + bom, bytes.size() - bom);
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_string::isomorphic_encode() const noexcept
+{
+    return infra_string_view{*this}.isomorphic_encode();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::isomorphic_decode(const infra_byte_sequence& bytes) noexcept
+{
+    // every byte is a one byte code unit, so the bytes are copied as they are
+    infra_string string;
+    string.append_units(reinterpret_cast<const std::uint8_t*>(std::to_address(bytes.cbegin())), bytes.size());
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::forgiving_base64_encode(const infra_byte_sequence& data) noexcept
+{
+    // the base64 alphabet is ASCII, so the characters are written straight into a one byte buffer
+    infra_string string;
+    string.reserve((data.size() + 2) / 3 * 4);
+    string.length = kernel::base64_encode(reinterpret_cast<const std::uint8_t*>(std::to_address(data.cbegin())), data.size(), string.latin1_data());
+    return string;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_byte_sequence> infra_string::forgiving_base64_decode() const noexcept
+{
+    return infra_string_view{*this}.forgiving_base64_decode();
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::ascii_lowercase() const noexcept
 {
     infra_string string;
-    for (const auto& point: points)
-    {
-        infra_code_point lowercase{static_cast<std::uint32_t>(std::tolower(static_cast<std::int32_t>(point)))};
-        string.push_code_unit(lowercase);
-        string.push_code_point(lowercase);
-    }
+    if (wide) string.widen();
+    string.reserve(length);
+    if (wide) kernel::ascii_lowercase(utf16_data(), string.utf16_data(), length);
+    else kernel::ascii_lowercase(latin1_data(), string.latin1_data(), length);
+    string.length = length;
     return string;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::ascii_uppercase() const noexcept
 {
     infra_string string;
-    for (const auto& point: points)
-    {
-        infra_code_point uppercase{static_cast<std::uint32_t>(std::toupper(static_cast<std::int32_t>(point)))};
-        string.push_code_unit(uppercase);
-        string.push_code_point(uppercase);
-    }
+    if (wide) string.widen();
+    string.reserve(length);
+    if (wide) kernel::ascii_uppercase(utf16_data(), string.utf16_data(), length);
+    else kernel::ascii_uppercase(latin1_data(), string.latin1_data(), length);
+    string.length = length;
     return string;
 }
+SOFTLOQ_WHATWG_INFRA_API void infra_string::ascii_lowercase_in_place() noexcept
+{
+    if (wide) kernel::ascii_lowercase(utf16_data(), utf16_data(), length);
+    else kernel::ascii_lowercase(latin1_data(), latin1_data(), length);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::ascii_uppercase_in_place() noexcept
+{
+    if (wide) kernel::ascii_uppercase(utf16_data(), utf16_data(), length);
+    else kernel::ascii_uppercase(latin1_data(), latin1_data(), length);
+}
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::strip_newlines() const noexcept
 {
     infra_string string;
-    for (const auto& point: points)
-    {
-        if (point == 0x000A || point == 0x000D) continue;
-        string.push_code_unit(point);
-        string.push_code_point(point);
-    }
+    if (wide) string.widen();
+    string.reserve(length);
+    if (wide) string.length = kernel::strip_newlines(utf16_data(), string.utf16_data(), length);
+    else string.length = kernel::strip_newlines(latin1_data(), string.latin1_data(), length);
     return string;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::normalize_newlines() const noexcept
 {
     infra_string string;
-    for (code_point_sequence_type::size_type i = {}; i < points.size(); ++i)
-    {
-        const auto& point = points[i];
-        if (string.size() && point == 0x000A)
-        {
-            auto end = --string.points.end();
-            if (*end == 0x000D)
-            {
-                *end = 0x000A;
-                *(--string.units.end()) = 0x000A;
-                continue;
-            }
-        }
-        string.push_code_unit(point);
-        string.push_code_point(point);
-    }
-    for (auto& unit: string.units) if (unit == 0x000D) unit = 0x000A;
-    for (auto& point: string.points) if (point == 0x000D) point = 0x000A;
+    if (wide) string.widen();
+    string.reserve(length);
+    if (wide) string.length = kernel::normalize_newlines(utf16_data(), string.utf16_data(), length);
+    else string.length = kernel::normalize_newlines(latin1_data(), string.latin1_data(), length);
     return string;
 }
+SOFTLOQ_WHATWG_INFRA_API void infra_string::strip_newlines_in_place() noexcept
+{
+    if (wide) length = kernel::strip_newlines(utf16_data(), utf16_data(), length);
+    else length = kernel::strip_newlines(latin1_data(), latin1_data(), length);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::normalize_newlines_in_place() noexcept
+{
+    if (wide) length = kernel::normalize_newlines(utf16_data(), utf16_data(), length);
+    else length = kernel::normalize_newlines(latin1_data(), latin1_data(), length);
+}
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::strip_spaces() const noexcept
 {
-    infra_string strip_string;
-    code_unit_sequence_type::size_type start_space = {};
-    code_unit_sequence_type::size_type end_space = {};
-    for (auto it = units.cbegin(); it != units.cend(); ++it)
-    {
-        if (*it != 0x20) break;
-        start_space++;
-    }
-    for (auto it = units.crbegin(); it != units.crend(); ++it)
-    {
-        if (*it != 0x20) break;
-        end_space++;
-    }
-    for (code_unit_sequence_type::size_type i = start_space; i < units.size() - end_space; ++i) strip_string.push_code_unit(units[i]);
-    return strip_string;
+    return infra_string{infra_string_view{*this}.strip_spaces()};
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::collapse_spaces() const noexcept
 {
     infra_string collapse_string;
-    code_unit_sequence_type::size_type start_space = {};
-    code_unit_sequence_type::size_type end_space = {};
-    for (auto it = units.cbegin(); it != units.cend(); ++it)
-    {
-        if (*it != 0x20) break;
-        start_space++;
-    }
-    for (auto it = units.crbegin(); it != units.crend(); ++it)
-    {
-        if (*it != 0x20) break;
-        end_space++;
-    }
+    size_type start_space = {};
+    size_type end_space = {};
+    while (start_space < length && unit_at(buffer(), wide, start_space) == 0x20) start_space++;
+    if (start_space == length) return collapse_string;
+    while (unit_at(buffer(), wide, length - end_space - 1) == 0x20) end_space++;
+    collapse_string.reserve(length - end_space - start_space);
+    if (wide) collapse_string.widen();
     bool found_space = false;
-    for (code_unit_sequence_type::size_type i = start_space; i < units.size() - end_space; ++i)
+    for (size_type i = start_space; i < length - end_space; ++i)
     {
-        const infra_code_unit& unit = units[i];
+        const std::uint16_t unit = unit_at(buffer(), wide, i);
         if (found_space)
         {
             if (unit == 0x20) continue;
             found_space = false;
         }
         else if (unit == 0x20) found_space = true;
-        collapse_string.push_code_unit(units[i]);
+        collapse_string.push_code_unit(infra_code_unit{unit});
     }
     return collapse_string;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::collect(const std::function<const bool (const infra_code_point)>& cond) const noexcept
 {
     infra_string collect_string;
-    for (const auto& point: points) if (cond(point)) collect_string.push_code_point(point);
+    for (const auto point: code_points()) if (cond(point)) collect_string.push_code_unit(point);
     return collect_string;
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::skip_spaces(code_point_sequence_type::size_type& point_pos) const noexcept
 {
-    for (; point_pos < points.size(); ++point_pos)
-    {
-        if (points[point_pos] == 0x20) continue;
-        break;
-    }
+    infra_string_view{*this}.skip_spaces(point_pos);
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::tokens_type infra_string::split(const infra_code_point& delim) const noexcept
 {
     tokens_type tokens;
-    infra_string token;
-    for (code_point_sequence_type::size_type i = {}; i < points.size(); ++i)
-    {
-        const auto& code_point = points[i];
-        if (code_point == delim)
-        {
-            tokens.append(token);
-            token = {};
-        }
-        else if (i == points.size() - 1)
-        {
-            token.push_code_point(code_point);
-            tokens.append(token);
-        }
-        else token.push_code_point(code_point);
-    }
+    for (const auto token: infra_string_view{*this}.split(delim)) tokens.append(infra_string{token});
     return tokens;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::tokens_type infra_string::split_spaces() const noexcept
 {
     tokens_type tokens;
-    infra_string token;
-    for (code_point_sequence_type::size_type i = {}; i < points.size();)
-    {
-        const auto& code_point = points[i];
-        if (code_point == 0x20)
-        {   
-            tokens.append(token);
-            token = {};
-            skip_spaces(++i);
-        }
-        else if (i == points.size() - 1)
-        {
-            token.push_code_point(code_point);
-            tokens.append(token);
-            ++i;
-        }
-        else
-        {
-            token.push_code_point(code_point);
-            ++i;
-        }  
-    }
+    for (const auto token: infra_string_view{*this}.split_spaces()) tokens.append(infra_string{token});
     return tokens;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string::tokens_type infra_string::split_commas() const noexcept
 {
     tokens_type tokens;
-    infra_string token;
-    for (code_point_sequence_type::size_type i = {}; i < points.size(); ++i)
-    {
-        const auto& code_point = points[i];
-        if (code_point == 0x2C)
-        {
-            tokens.append(token.strip_spaces());
-            token = {};
-        }
-        else if (i == points.size() - 1)
-        {
-            token.push_code_point(code_point);
-            tokens.append(token.strip_spaces());
-        }
-        else token.push_code_point(code_point);
-    }
+    for (const auto token: infra_string_view{*this}.split_commas()) tokens.append(infra_string{token});
     return tokens;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::concatenate(const infra_list<infra_string>& list, infra_string separator) noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::concatenate(const infra_list<infra_string>& list) noexcept
+{
+    return concatenate(list, infra_string_view{});
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::concatenate(const infra_list<infra_string>& list, const infra_string_view& separator) noexcept
 {
     infra_string concatenate_string;
     for (const auto& string: list)
     {
-        if (concatenate_string.size()) for (const auto& unit: separator) concatenate_string.push_code_unit(unit);
-        for (const auto& unit: string) concatenate_string.push_code_unit(unit);
+        if (concatenate_string.size()) concatenate_string.push_back(separator);
+        concatenate_string.push_back(string);
     }
     return concatenate_string;
 }
@@ -457,122 +738,120 @@ SOFTLOQ_WHATWG_INFRA_API infra_string infra_string::concatenate(const infra_list
 
 // WHATWG sequence member functions //
 
-SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& infra_string::front_code_unit() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::front_code_unit() const noexcept
 {
-    return units.front();
+    return infra_code_unit{unit_at(buffer(), wide, 0)};
 }
-SOFTLOQ_WHATWG_INFRA_API const infra_code_point& infra_string::front_code_point() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string::front_code_point() const noexcept
 {
-    return points.front();
+    return code_points().front();
 }
-SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& infra_string::back_code_unit() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::back_code_unit() const noexcept
 {
-    return units.back();
+    return infra_code_unit{unit_at(buffer(), wide, length - 1)};
 }
-SOFTLOQ_WHATWG_INFRA_API const infra_code_point& infra_string::back_code_point() const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string::back_code_point() const noexcept
 {
-    return points.back();
+    return code_points().back();
 }
 
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(const std::string& values) noexcept
 {
-    for (const auto& value: values)
-    {
-        push_code_unit(infra_code_unit{static_cast<std::uint8_t>(value)});
-        push_code_point(infra_code_point{static_cast<std::uint8_t>(value)});
-    }
+    push_back(values);
     return *this;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(const infra_string& values) noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(const infra_string_view& values) noexcept
 {
-    for (const auto& value: values)
-    {
-        push_code_unit(value);
-        push_code_point(value);
-    }
+    push_back(values);
     return *this;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(const infra_code_unit& unit) noexcept
 {
     push_code_unit(unit);
-    push_code_point(unit);
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(infra_code_unit&& unit) noexcept
+{
+    push_code_unit(unit);
     return *this;
 }
 SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(const infra_code_point& point) noexcept
 {
     push_code_unit(point);
-    push_code_point(point);
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string& infra_string::operator+=(infra_code_point&& point) noexcept
+{
+    push_code_unit(point);
     return *this;
 }
 
 SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(const std::string& values) noexcept
 {
-    for (const auto& value: values)
-    {
-        push_code_unit(infra_code_unit{static_cast<std::uint8_t>(value)});
-        push_code_point(infra_code_point{static_cast<std::uint8_t>(value)});
-    }
+    append_units(reinterpret_cast<const std::uint8_t*>(values.data()), values.size());
 }
-SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(const infra_string& values) noexcept
+SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(const infra_string_view& values) noexcept
 {
-    for (const auto& value: values)
+    // growing would invalidate the units of a view into this string
+    if (overlaps(values))
     {
-        push_code_unit(value);
-        push_code_point(value);
+        const infra_string copy{values};
+        push_back(copy);
     }
+    else if (values.is_wide()) append_units(values.code_units().utf16_data(), values.size());
+    else append_units(values.code_units().latin1_data(), values.size());
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(const infra_code_unit& unit) noexcept
 {
     push_code_unit(unit);
-    push_code_point(unit);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(infra_code_unit&& unit) noexcept
+{
+    push_code_unit(unit);
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(const infra_code_point& point) noexcept
 {
     push_code_unit(point);
-    push_code_point(point);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::push_back(infra_code_point&& point) noexcept
+{
+    push_code_unit(point);
 }
 
 SOFTLOQ_WHATWG_INFRA_API void infra_string::pop_code_unit() noexcept
 {
-    if (units.size() >= 2 &&  (++units.rbegin())->is_leading_surrogate() && units.rbegin()->is_trailing_surrogate())
-    {
-        units.pop_back();
-        points.back() = units.back();
-    }
-    else
-    {
-        units.pop_back();
-        points.pop_back();
-    }
+    --length;
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::pop_code_point() noexcept
 {
-    if (points.back() >= 0x010000)
-    {
-        units.pop_back();
-        units.pop_back();
-        points.pop_back();
-    }
-    else
-    {
-        units.pop_back();
-        points.pop_back();
-    }
+    length -= length >= 2 ? point_width_at(buffer(), length, wide, length - 2) : 1;
 }
 
 SOFTLOQ_WHATWG_INFRA_API const bool infra_string::empty() const noexcept
 {
-    return units.size();
+    return !length;
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::clear() noexcept
 {
-    units.clear();
-    points.clear();
+    // the buffer is kept, and holds twice as many units once it is one byte wide again
+    length = 0;
+    wide = false;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::reserve(const size_type new_capacity) noexcept
+{
+    const size_type new_capacity_bytes = new_capacity << wide;
+    if (new_capacity_bytes <= capacity_bytes()) return;
+    void* new_buffer = ::operator new(new_capacity_bytes);
+    if (length) std::memcpy(new_buffer, buffer(), length << wide);
+    if (!is_local) ::operator delete(storage.heap.data);
+    storage.heap.data = new_buffer;
+    storage.heap.capacity_bytes = new_capacity_bytes;
+    is_local = false;
 }
 
-SOFTLOQ_WHATWG_INFRA_API const infra_code_unit& infra_string::operator[](const code_unit_sequence_type::size_type index) const noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string::operator[](const code_unit_sequence_type::size_type index) const noexcept
 {
-    return units[index];
+    return infra_code_unit{unit_at(buffer(), wide, index)};
 }
 
 //----------------------------------//
@@ -586,7 +865,7 @@ SOFTLOQ_WHATWG_INFRA_API const infra_primitive_type infra_string::primitive_type
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::print(std::ostream& out) const noexcept
 {
-    units.print(out);
+    infra_string_view{*this}.print(out);
 }
 
 //---------------------------------//
@@ -595,37 +874,108 @@ SOFTLOQ_WHATWG_INFRA_API void infra_string::print(std::ostream& out) const noexc
 
 SOFTLOQ_WHATWG_INFRA_API void infra_string::push_code_unit(const infra_code_unit& unit) noexcept
 {
-    units.push_back(static_cast<std::uint16_t>(unit));
+    const std::uint16_t value = static_cast<std::uint16_t>(unit);
+    if (!wide && value > 0xFF) widen();
+    grow(1);
+    if (wide) utf16_data()[length++] = value;
+    else latin1_data()[length++] = static_cast<std::uint8_t>(value);
 }
 SOFTLOQ_WHATWG_INFRA_API void infra_string::push_code_unit(const infra_code_point& point) noexcept
 {
     if (!point.is_valid())
     {
-        units.push_back(0xFFFD);
+        push_code_unit(infra_code_unit{0xFFFD});
     }
     else if (point >= 0x10000)
     {
-        units.push_back(0xD800 + ((point - 0x10000) >> 10));
-        units.push_back(0xDC00 + ((point - 0x10000) & 0x3FF));
+        push_code_unit(infra_code_unit{static_cast<std::uint16_t>(0xD800 + ((point - 0x10000) >> 10))});
+        push_code_unit(infra_code_unit{static_cast<std::uint16_t>(0xDC00 + ((point - 0x10000) & 0x3FF))});
     }
-    else units.push_back(static_cast<std::uint16_t>(point));
+    else push_code_unit(infra_code_unit{static_cast<std::uint16_t>(point)});
 }
-SOFTLOQ_WHATWG_INFRA_API void infra_string::push_code_point(const infra_code_unit& unit) noexcept
+
+SOFTLOQ_WHATWG_INFRA_API void infra_string::append_units(const std::uint8_t* units, const size_type count) noexcept
 {
-    push_code_point(infra_code_point{unit});
+    if (!count) return;
+    grow(count);
+    if (wide) kernel::widen(units, utf16_data() + length, count);
+    else std::memcpy(latin1_data() + length, units, count);
+    length += count;
 }
-SOFTLOQ_WHATWG_INFRA_API void infra_string::push_code_point(const infra_code_point& point) noexcept
+SOFTLOQ_WHATWG_INFRA_API void infra_string::append_units(const std::uint16_t* units, const size_type count) noexcept
 {
-    if (point.is_trailing_surrogate() && points.size())
+    if (!count) return;
+    if (!wide && !kernel::is_isomorphic(units, count)) widen();
+    grow(count);
+    if (wide) std::memcpy(utf16_data() + length, units, count << 1);
+    else kernel::narrow(units, latin1_data() + length, count);
+    length += count;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::grow(const size_type count) noexcept
+{
+    const size_type required = length + count;
+    if ((required << wide) <= capacity_bytes()) return;
+    reserve(std::max(required, (capacity_bytes() >> wide) * 2));
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::widen() noexcept
+{
+    if (wide) return;
+    if ((length << 1) <= capacity_bytes())
     {
-        auto end = --points.end();
-        if (end->is_leading_surrogate())
-        {
-            *end = ((static_cast<std::uint32_t>(*end) - 0xD800) << 10) + (point - 0xDC00) + 0x10000;
-            return;
-        }
+        // widen in place, back to front so that no unit is overwritten before it is read
+        const std::uint8_t* narrow = latin1_data();
+        std::uint16_t* wide_units = utf16_data();
+        for (size_type i = length; i--;) wide_units[i] = narrow[i];
+        wide = true;
+        return;
     }
-    points.push_back(point);
+    const size_type new_capacity_bytes = capacity_bytes() << 1;
+    std::uint16_t* new_buffer = static_cast<std::uint16_t*>(::operator new(new_capacity_bytes));
+    kernel::widen(latin1_data(), new_buffer, length);
+    if (!is_local) ::operator delete(storage.heap.data);
+    storage.heap.data = new_buffer;
+    storage.heap.capacity_bytes = new_capacity_bytes;
+    is_local = false;
+    wide = true;
+}
+
+SOFTLOQ_WHATWG_INFRA_API void infra_string::narrow() noexcept
+{
+    if (!wide) return;
+    kernel::narrow(utf16_data(), latin1_data(), length);
+    wide = false;
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string::decode_utf8(const std::uint8_t* bytes, const size_type count) noexcept
+{
+    // ASCII input is copied as is; anything else is decoded into two byte units in one pass and narrowed back if every unit fits in one byte
+    clear();
+    if (kernel::is_ascii(bytes, count)) return append_units(bytes, count);
+    widen();
+    reserve(count);
+    length = kernel::utf8_decode(bytes, utf16_data(), count);
+    if (kernel::is_isomorphic(utf16_data(), length)) narrow();
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string::overlaps(const infra_string_view& values) const noexcept
+{
+    const std::uint8_t* units = values.code_units().latin1_data();
+    const std::uint8_t* first = latin1_data();
+    return std::less_equal<const std::uint8_t*>{}(first, units) && std::less<const std::uint8_t*>{}(units, first + capacity_bytes());
+}
+SOFTLOQ_WHATWG_INFRA_API void* infra_string::buffer() const noexcept
+{
+    return is_local ? const_cast<std::uint8_t*>(storage.local) : storage.heap.data;
+}
+SOFTLOQ_WHATWG_INFRA_API const infra_string::size_type infra_string::capacity_bytes() const noexcept
+{
+    return is_local ? local_capacity_bytes : storage.heap.capacity_bytes;
+}
+SOFTLOQ_WHATWG_INFRA_API std::uint8_t* infra_string::latin1_data() const noexcept
+{
+    return static_cast<std::uint8_t*>(buffer());
+}
+SOFTLOQ_WHATWG_INFRA_API std::uint16_t* infra_string::utf16_data() const noexcept
+{
+    return static_cast<std::uint16_t*>(buffer());
 }
 
 //--------------------------//
@@ -642,7 +992,7 @@ SOFTLOQ_WHATWG_INFRA_API const bool infra_string::operator>(const infra_string&
 }
 SOFTLOQ_WHATWG_INFRA_API const bool infra_string::operator==(const infra_string& b) const noexcept
 {
-    return units == b.units;
+    return infra_string_view{*this} == infra_string_view{b};
 }
 
 //------------------------------------//
@@ -654,7 +1004,7 @@ SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const std
     infra_string combine{a};
     return combine += b;
 }
-SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_string& b) noexcept
+SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const infra_string_view& b) noexcept
 {
     infra_string combine{a};
     return combine += b;
@@ -671,27 +1021,4 @@ SOFTLOQ_WHATWG_INFRA_API infra_string operator+(const infra_string& a, const inf
 }
 
 //---------------------//
-
-// WHATWG string comparison functions //
-
-SOFTLOQ_WHATWG_INFRA_API const bool is_prefix(const infra_string& a, const infra_string& b) noexcept
-{
-    return a.size() <= b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin());
-}
-SOFTLOQ_WHATWG_INFRA_API const bool is_suffix(const infra_string& a, const infra_string& b) noexcept
-{
-    return a.size() <= b.size() && std::equal(a.crbegin(), a.crend(), b.crbegin());
-}
-SOFTLOQ_WHATWG_INFRA_API const bool is_code_unit_less_than(const infra_string& a, const infra_string& b) noexcept
-{
-    if (is_prefix(b, a)) return false;
-    else if (is_prefix(a, b)) return true;
-    else return std::equal(a.cbegin(), a.cend(), b.cbegin(), std::less_equal<infra_code_unit>());
-}
-SOFTLOQ_WHATWG_INFRA_API const bool is_ascii_iequal(const infra_string& a, const infra_string& b) noexcept
-{
-    return a.size() == b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin(), [](const auto& unit_a, const auto& unit_b) { return std::tolower(static_cast<std::uint16_t>(unit_a)) == std::tolower(static_cast<std::uint16_t>(unit_b)); });
-}
-
-//------------------------------------//
 }
\ No newline at end of file
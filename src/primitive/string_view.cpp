@@ -0,0 +1,498 @@
+/**
+ * @file string_view.cpp
+ * @author Brandon Foster (https://github.com/BrandonFoster)
+ * @brief Implementation of the WHATWG infra string view class.
+ * @version 1.0.0 */
+
+#include "softloq/whatwg/infra/primitive/string_view.hpp"
+#include "kernel.hpp"
+
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace softloq::whatwg
+{
+namespace
+{
+// raw code unit helpers //
+
+inline const std::uint16_t unit_at(const void* units, const bool wide, const std::size_t index) noexcept
+{
+    return wide ? static_cast<const std::uint16_t*>(units)[index] : static_cast<const std::uint8_t*>(units)[index];
+}
+/** @brief Returns the index of the first code unit at or after pos that equals the value, or length if there is none. */
+inline const std::size_t find_unit(const void* units, const bool wide, const std::size_t pos, const std::size_t length, const std::uint16_t value) noexcept
+{
+    if (wide)
+    {
+        const std::uint16_t* wide_units = static_cast<const std::uint16_t*>(units);
+        return std::find(wide_units + pos, wide_units + length, value) - wide_units;
+    }
+    if (value > 0xFF) return length;
+    const std::uint8_t* narrow = static_cast<const std::uint8_t*>(units);
+    const void* found = std::memchr(narrow + pos, value, length - pos);
+    return found ? static_cast<const std::uint8_t*>(found) - narrow : length;
+}
+inline const std::uint16_t ascii_lower_unit(const std::uint16_t unit) noexcept
+{
+    return 0x41 <= unit && unit <= 0x5A ? unit + 0x20 : unit;
+}
+
+//------------------------//
+}
+
+// token view //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator::const_iterator() noexcept
+: source(), type(split_type::spaces), delim(), pos(0), token_end(0), next(0)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator::const_iterator(const token_view& tokens, const size_type pos) noexcept
+: source(tokens.source), type(tokens.type), delim(tokens.delim), pos(pos), token_end(pos), next(pos)
+{
+    if (pos < source.length) find_token();
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator::reference infra_string_view::token_view::const_iterator::operator*() const noexcept
+{
+    const infra_string_view token = source.code_unit_substr(pos, token_end - pos);
+    return type == split_type::commas ? token.strip_spaces() : token;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator& infra_string_view::token_view::const_iterator::operator++() noexcept
+{
+    // a trailing delimiter does not produce an empty token
+    pos = next;
+    if (pos < source.length) find_token();
+    return *this;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator infra_string_view::token_view::const_iterator::operator++(int) noexcept
+{
+    const_iterator it = *this;
+    ++*this;
+    return it;
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::token_view::const_iterator::operator==(const const_iterator& b) const noexcept
+{
+    return pos == b.pos;
+}
+
+SOFTLOQ_WHATWG_INFRA_API void infra_string_view::token_view::const_iterator::find_token() noexcept
+{
+    const void* units = source.units;
+    const bool wide = source.wide;
+    const size_type length = source.length;
+    switch (type)
+    {
+    case split_type::spaces:
+        token_end = find_unit(units, wide, pos, length, 0x20);
+        for (next = token_end; next < length && unit_at(units, wide, next) == 0x20;) ++next;
+        break;
+    case split_type::commas:
+        token_end = find_unit(units, wide, pos, length, 0x2C);
+        next = token_end < length ? token_end + 1 : length;
+        break;
+    case split_type::code_point:
+        // a code point that is a single, non-surrogate code unit can be searched for unit by unit
+        if (delim < 0x10000 && !delim.is_surrogate())
+        {
+            token_end = find_unit(units, wide, pos, length, static_cast<std::uint16_t>(delim));
+            next = token_end < length ? token_end + 1 : length;
+            break;
+        }
+        const code_point_sequence_type points = source.code_points();
+        auto it = code_point_sequence_type::const_iterator{units, length, wide, pos};
+        while (it != points.cend() && *it != delim) ++it;
+        token_end = it.position();
+        next = it != points.cend() ? token_end + it.width() : length;
+        break;
+    }
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::token_view(const infra_string_view& source, const split_type type, const infra_code_point& delim) noexcept
+: source(source), type(type), delim(delim)
+{
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator infra_string_view::token_view::begin() const noexcept
+{
+    return const_iterator{*this, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator infra_string_view::token_view::cbegin() const noexcept
+{
+    return const_iterator{*this, 0};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator infra_string_view::token_view::end() const noexcept
+{
+    return const_iterator{*this, source.length};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::token_view::const_iterator infra_string_view::token_view::cend() const noexcept
+{
+    return const_iterator{*this, source.length};
+}
+
+SOFTLOQ_WHATWG_INFRA_API const infra_string_view::token_view::size_type infra_string_view::token_view::size() const noexcept
+{
+    return std::distance(cbegin(), cend());
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::token_view::empty() const noexcept
+{
+    return !source.length;
+}
+
+//------------//
+
+// constructors //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::infra_string_view() noexcept
+: units(nullptr), length(0), wide(false)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::infra_string_view(const infra_string& string) noexcept
+: infra_string_view(string.code_units())
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::infra_string_view(const code_unit_sequence_type& units) noexcept
+: units(units.latin1_data()), length(units.size()), wide(units.is_wide())
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::infra_string_view(const std::uint8_t* units, const size_type length) noexcept
+: units(units), length(length), wide(false)
+{
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::infra_string_view(const std::uint16_t* units, const size_type length) noexcept
+: units(units), length(length), wide(true)
+{
+}
+
+//--------------//
+
+// iterator member functions //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_iterator infra_string_view::begin() const noexcept
+{
+    return code_units().cbegin();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_iterator infra_string_view::cbegin() const noexcept
+{
+    return code_units().cbegin();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_iterator infra_string_view::end() const noexcept
+{
+    return code_units().cend();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_iterator infra_string_view::cend() const noexcept
+{
+    return code_units().cend();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_reverse_iterator infra_string_view::rbegin() const noexcept
+{
+    return code_units().crbegin();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_reverse_iterator infra_string_view::crbegin() const noexcept
+{
+    return code_units().crbegin();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_reverse_iterator infra_string_view::rend() const noexcept
+{
+    return code_units().crend();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::const_reverse_iterator infra_string_view::crend() const noexcept
+{
+    return code_units().crend();
+}
+
+//---------------------------//
+
+// WHATWG string member functions //
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::code_unit_sequence_type infra_string_view::code_units() const noexcept
+{
+    return code_unit_sequence_type{units, length, wide};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::code_point_sequence_type infra_string_view::code_points() const noexcept
+{
+    return code_point_sequence_type{units, length, wide};
+}
+
+SOFTLOQ_WHATWG_INFRA_API std::string infra_string_view::code_unit_str() const noexcept
+{
+    std::stringstream out;
+    for (size_type i = 0; i < length; ++i)
+    {
+        out << infra_code_unit{unit_at(units, wide, i)};
+        if (i != length - 1) out << " ";
+    }
+    return out.str();
+}
+SOFTLOQ_WHATWG_INFRA_API std::string infra_string_view::code_point_str() const noexcept
+{
+    std::stringstream out;
+    const code_point_sequence_type points = code_points();
+    for (auto it = points.cbegin(); it != points.cend();)
+    {
+        out << *it;
+        if (++it != points.cend()) out << " ";
+    }
+    return out.str();
+}
+SOFTLOQ_WHATWG_INFRA_API std::string infra_string_view::quoted_str() const noexcept
+{
+    std::string quoted(byte_encoding_size() + 2, '"');
+    byte_encoding(reinterpret_cast<std::uint8_t*>(quoted.data()) + 1);
+    return quoted;
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::size_type infra_string_view::size() const noexcept
+{
+    return length;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::code_unit_sequence_type::size_type infra_string_view::code_unit_size() const noexcept
+{
+    return length;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::code_point_sequence_type::size_type infra_string_view::code_point_size() const noexcept
+{
+    return code_points().size();
+}
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::is_ascii() const noexcept
+{
+    return wide ? kernel::is_ascii(static_cast<const std::uint16_t*>(units), length) : kernel::is_ascii(static_cast<const std::uint8_t*>(units), length);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::is_isomorphic() const noexcept
+{
+    // surrogates are above 0xFF, so a code unit check covers supplementary code points as well
+    return !wide || kernel::is_isomorphic(static_cast<const std::uint16_t*>(units), length);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::is_scalar() const noexcept
+{
+    // one byte code units cannot be surrogates
+    return !wide || kernel::is_scalar(static_cast<const std::uint16_t*>(units), length);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::is_wide() const noexcept
+{
+    return wide;
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_string_view infra_string_view::code_unit_substr(const size_type start, const size_type length) const noexcept
+{
+    if (start >= infra_string_view::length) return infra_string_view{};
+    const size_type count = std::min(length, infra_string_view::length - start);
+    if (wide) return infra_string_view{static_cast<const std::uint16_t*>(units) + start, count};
+    return infra_string_view{static_cast<const std::uint8_t*>(units) + start, count};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view infra_string_view::code_unit_substr(const size_type start) const noexcept
+{
+    return code_unit_substr(start, length);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view infra_string_view::code_point_substr(const size_type start, const size_type length) const noexcept
+{
+    if (!wide) return code_unit_substr(start, length);
+    const code_point_sequence_type points = code_points();
+    auto first = points.cbegin();
+    size_type i = 0;
+    for (; i < start && first != points.cend(); ++i) ++first;
+    if (first == points.cend()) return infra_string_view{};
+    auto last = first;
+    for (i = 0; i < length && last != points.cend(); ++i) ++last;
+    return code_unit_substr(first.position(), last.position() - first.position());
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view infra_string_view::code_point_substr(const size_type start) const noexcept
+{
+    return code_point_substr(start, length);
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_string_view::byte_encoding() const noexcept
+{
+    infra_byte_sequence bytes;
+    bytes.resize(byte_encoding_size());
+    // infra_byte is a standard layout wrapper of a single byte, so the bytes are contiguous
+    byte_encoding(reinterpret_cast<std::uint8_t*>(std::to_address(bytes.begin())));
+    return bytes;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::size_type infra_string_view::byte_encoding(std::uint8_t* bytes) const noexcept
+{
+    if (wide) return kernel::utf8_encode(static_cast<const std::uint16_t*>(units), bytes, length);
+    return kernel::utf8_encode(static_cast<const std::uint8_t*>(units), bytes, length);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::size_type infra_string_view::byte_encoding_size() const noexcept
+{
+    if (wide) return kernel::utf8_size(static_cast<const std::uint16_t*>(units), length);
+    return kernel::utf8_size(static_cast<const std::uint8_t*>(units), length);
+}
+SOFTLOQ_WHATWG_INFRA_API infra_byte_sequence infra_string_view::isomorphic_encode() const noexcept
+{
+    infra_byte_sequence bytes;
+    bytes.resize(length);
+    std::uint8_t* data = reinterpret_cast<std::uint8_t*>(std::to_address(bytes.begin()));
+    if (wide) kernel::narrow(static_cast<const std::uint16_t*>(units), data, length);
+    else if (length) std::memcpy(data, units, length);
+    return bytes;
+}
+SOFTLOQ_WHATWG_INFRA_API std::optional<infra_byte_sequence> infra_string_view::forgiving_base64_decode() const noexcept
+{
+    infra_byte_sequence bytes;
+    bytes.resize(kernel::base64_decode_capacity(length));
+    std::uint8_t* data = reinterpret_cast<std::uint8_t*>(std::to_address(bytes.begin()));
+    std::size_t written = 0;
+    std::uint32_t bits = 0, sextets = 0, padding = 0;
+    const bool valid = wide
+        ? kernel::base64_decode(static_cast<const std::uint16_t*>(units), length, data, written, bits, sextets, padding)
+        : kernel::base64_decode(static_cast<const std::uint8_t*>(units), length, data, written, bits, sextets, padding);
+    if (!valid || !kernel::base64_finish(data, written, bits, sextets, padding)) return std::nullopt;
+    bytes.resize(written);
+    return bytes;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view infra_string_view::strip_spaces() const noexcept
+{
+    size_type start_space = {};
+    size_type end_space = {};
+    while (start_space < length && unit_at(units, wide, start_space) == 0x20) start_space++;
+    if (start_space == length) return infra_string_view{};
+    while (unit_at(units, wide, length - end_space - 1) == 0x20) end_space++;
+    return code_unit_substr(start_space, length - end_space - start_space);
+}
+SOFTLOQ_WHATWG_INFRA_API void infra_string_view::skip_spaces(code_point_sequence_type::size_type& point_pos) const noexcept
+{
+    const code_point_sequence_type points = code_points();
+    auto it = points.cbegin();
+    for (code_point_sequence_type::size_type i = 0; i < point_pos && it != points.cend(); ++i) ++it;
+    for (; it != points.cend() && *it == 0x20; ++it) ++point_pos;
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::tokens_type infra_string_view::split(const infra_code_point& delim) const noexcept
+{
+    return tokens_type{*this, tokens_type::split_type::code_point, delim};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::tokens_type infra_string_view::split_spaces() const noexcept
+{
+    return tokens_type{*this, tokens_type::split_type::spaces, infra_code_point{0x20}};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_string_view::tokens_type infra_string_view::split_commas() const noexcept
+{
+    return tokens_type{*this, tokens_type::split_type::commas, infra_code_point{0x2C}};
+}
+
+//--------------------------------//
+
+// WHATWG sequence member functions //
+
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string_view::front_code_unit() const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, 0)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string_view::front_code_point() const noexcept
+{
+    return code_points().front();
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string_view::back_code_unit() const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, length - 1)};
+}
+SOFTLOQ_WHATWG_INFRA_API infra_code_point infra_string_view::back_code_point() const noexcept
+{
+    return code_points().back();
+}
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::empty() const noexcept
+{
+    return !length;
+}
+
+SOFTLOQ_WHATWG_INFRA_API infra_code_unit infra_string_view::operator[](const code_unit_sequence_type::size_type index) const noexcept
+{
+    return infra_code_unit{unit_at(units, wide, index)};
+}
+
+//----------------------------------//
+
+// WHATWG primitive functions //
+
+SOFTLOQ_WHATWG_INFRA_API void infra_string_view::print(std::ostream& out) const noexcept
+{
+    // a string prints as the list of its code units, « 0x0061, 0x0062 »
+    out << "« ";
+    for (size_type i = 0; i < length; ++i) out << infra_code_unit{unit_at(units, wide, i)} << (i != length - 1 ? ", " : " ");
+    out << "»";
+}
+SOFTLOQ_WHATWG_INFRA_API std::ostream& operator<<(std::ostream& out, const infra_string_view& view) noexcept
+{
+    view.print(out);
+    return out;
+}
+
+//----------------------------//
+
+// WHATWG string comparison functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::operator<(const infra_string_view& b) const noexcept
+{
+    return is_code_unit_less_than(*this, b);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::operator>(const infra_string_view& b) const noexcept
+{
+    return is_code_unit_less_than(b, *this);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool infra_string_view::operator==(const infra_string_view& b) const noexcept
+{
+    if (length != b.length) return false;
+    if (wide == b.wide) return !length || !std::memcmp(units, b.units, length << wide);
+    const std::uint8_t* narrow = static_cast<const std::uint8_t*>(wide ? b.units : units);
+    const std::uint16_t* wide_units = static_cast<const std::uint16_t*>(wide ? units : b.units);
+    return std::equal(narrow, narrow + length, wide_units);
+}
+SOFTLOQ_WHATWG_INFRA_API const std::size_t infra_string_view::hash() const noexcept
+{
+    // four code units are mixed at a time as the 16 bit lanes of one word, which comes out the same from one and two byte units
+    constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15;
+    std::uint64_t state = length * multiplier;
+    const auto mix = [&state](const std::uint64_t word)
+    {
+        state = (state ^ word) * multiplier;
+        state ^= state >> 29;
+    };
+    const auto run = [&](const auto* units)
+    {
+        size_type i = 0;
+        for (; i + 4 <= length; i += 4)
+        {
+            mix(std::uint64_t{units[i]} | std::uint64_t{units[i + 1]} << 16 | std::uint64_t{units[i + 2]} << 32 | std::uint64_t{units[i + 3]} << 48);
+        }
+        if (i == length) return;
+        std::uint64_t word = 0;
+        for (std::uint32_t lane = 0; i < length; ++i, lane += 16) word |= std::uint64_t{units[i]} << lane;
+        mix(word);
+    };
+    if (wide) run(static_cast<const std::uint16_t*>(units));
+    else run(static_cast<const std::uint8_t*>(units));
+    return static_cast<std::size_t>(state ^ state >> 32);
+}
+
+//------------------------------------//
+
+// WHATWG string comparison functions //
+
+SOFTLOQ_WHATWG_INFRA_API const bool is_prefix(const infra_string_view& a, const infra_string_view& b) noexcept
+{
+    return a.size() <= b.size() && a == b.code_unit_substr(0, a.size());
+}
+SOFTLOQ_WHATWG_INFRA_API const bool is_suffix(const infra_string_view& a, const infra_string_view& b) noexcept
+{
+    return a.size() <= b.size() && a == b.code_unit_substr(b.size() - a.size());
+}
+SOFTLOQ_WHATWG_INFRA_API const bool is_code_unit_less_than(const infra_string_view& a, const infra_string_view& b) noexcept
+{
+    if (is_prefix(b, a)) return false;
+    else if (is_prefix(a, b)) return true;
+    // compare the first code units at which the strings differ
+    const auto mismatch = std::mismatch(a.cbegin(), a.cend(), b.cbegin());
+    return static_cast<std::uint16_t>(*mismatch.first) < static_cast<std::uint16_t>(*mismatch.second);
+}
+SOFTLOQ_WHATWG_INFRA_API const bool is_ascii_iequal(const infra_string_view& a, const infra_string_view& b) noexcept
+{
+    return a.size() == b.size() && std::equal(a.cbegin(), a.cend(), b.cbegin(), [](const infra_code_unit unit_a, const infra_code_unit unit_b) { return ascii_lower_unit(unit_a) == ascii_lower_unit(unit_b); });
+}
+
+//------------------------------------//
+}
\ No newline at end of file
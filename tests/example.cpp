@@ -1,9 +1,11 @@
 #include <softloq/whatwg/infra.hpp>
 
+#include <chrono>
 #include <iostream>
 #include <iomanip>
 #include <mutex>
 #include <vector>
+#include <thread>
 
 class ThreadSafeCounter {
 private:
@@ -97,8 +99,136 @@ int main()
 
     list.sort_ascending();
     list.sort_descending();
+
+    infra_node_list<infra_byte> node_list{0x3, 0x1, 0x2}; // node backed, iterators stay valid
+    auto node_it = node_list.begin();
+    node_list.prepend(0x0);
+    node_list.sort_ascending();
+    std::cout << node_list << " " << *node_it << std::endl;
+
+    infra_list<infra_byte, std::deque<infra_byte>, infra_no_lock> unlocked_list{0x1}; // one thread only, no locking
+    infra_shared_list<infra_byte> shared_list{0x1}; // readers share the lock
+    unlocked_list.append(0x2);
+    std::cout << unlocked_list.size() << " " << shared_list.contains(0x1) << std::endl;
+    shared_list.for_each([](const infra_byte& byte) { std::cout << byte << std::endl; });
+
+    infra_queue<infra_byte> queue{0x1};
+    queue.enqueue(0x2);
+    infra_stack<infra_byte> stack{0x1};
+    stack.push(0x2);
+    std::cout << *queue.dequeue() << " " << *stack.pop() << std::endl;
+
+    std::jthread producer([&queue] { queue.enqueue(0x3); }); // consumers park instead of spinning
+    infra_byte batch[4];
+    std::cout << queue.wait_dequeue() << " " << *queue.wait_dequeue_for(std::chrono::seconds{1}) << " " << queue.dequeue_bulk(batch, 4) << std::endl;
+
+    infra_queue<infra_string> string_queue{infra_string{"a"}, infra_string{"b"}, infra_string{"c"}}; // items are moved out, not copied
+    infra_string moved;
+    std::vector<infra_string> moved_batch(2);
+    string_queue.peek([](const infra_string& item) { std::cout << item << " "; });
+    std::cout << string_queue.try_dequeue(moved) << " " << moved << " " << string_queue.dequeue_into(moved_batch) << std::endl;
+    stack.push(0x5);
+    std::cout << stack.try_pop(batch[0]) << " " << batch[0] << " " << stack.pop_into(batch) << std::endl;
+
+    infra_ordered_set<infra_string> classes{infra_string{"a b a c"}.split_spaces()}; // repeated tokens are kept once
+    classes.prepend(infra_string{"c"});
+    classes.replace(infra_string{"a"}, infra_string{"d"});
+    const infra_ordered_set<infra_string> other{infra_string{"b"}, infra_string{"e"}};
+    std::cout << classes << " " << classes.contains(infra_string{"b"}) << " " << classes.set_union(other) << " " << classes.intersection(other)
+              << " " << classes.difference(other) << " " << other.is_subset(classes) << std::endl;
+
+    infra_lockfree_stack<infra_byte> lockfree_stack; // shared by any number of threads without a lock
+    lockfree_stack.push(0x1);
+    lockfree_stack.push(0x2);
+    std::cout << *lockfree_stack.peek() << " " << *lockfree_stack.pop() << " " << lockfree_stack.empty() << std::endl;
+
+    infra_mpmc_queue<infra_byte> mpmc_queue{4}; // bounded and lock-free, rounded up to a power of two
+    mpmc_queue.enqueue(0x3);
+    std::cout << mpmc_queue.capacity() << " " << *mpmc_queue.peek() << " " << *mpmc_queue.dequeue() << " " << mpmc_queue.empty() << std::endl;
+
+    infra_spsc_queue<infra_byte> spsc_queue{4}; // one producer thread and one consumer thread only
+    const infra_byte spsc_in[]{0x1, 0x2, 0x3};
+    infra_byte spsc_out[3];
+    spsc_queue.enqueue_n(spsc_in, 3);
+    std::cout << spsc_queue.dequeue_n(spsc_out, 3) << " " << spsc_out[2] << " " << spsc_queue.empty() << std::endl;
     //------------------//
 
+    // infra string code points //
+    infra_string string{"abc"};
+    string += infra_code_point{0x1F600};
+    for (const auto point: string.code_points()) std::cout << point << " ";
+    std::cout << string.code_unit_size() << " " << string.code_point_size() << std::endl;
+    //--------------------------//
+
+    // infra string views //
+    infra_string attribute{"  key = value , other "};
+    infra_string_view stripped = infra_string_view{attribute}.strip_spaces();
+    std::cout << stripped.quoted_str() << " " << is_prefix(infra_string{"key"}, stripped) << std::endl;
+    for (const auto token: infra_string_view{attribute}.split_commas()) std::cout << token.quoted_str() << " ";
+    std::cout << infra_string{"a b  c"}.split_spaces().size() << std::endl;
+    //--------------------//
+
+    // infra case mapping //
+    infra_string header{"Content-TYPE"};
+    header.ascii_lowercase_in_place();
+    infra_byte_sequence method{std::string{"get"}};
+    std::cout << header.quoted_str() << " " << method.uppercase().quoted_string() << std::endl;
+    //--------------------//
+
+    // infra newlines //
+    infra_string body{"line\r\nnext\rlast\n"};
+    body.normalize_newlines_in_place();
+    std::cout << std::dec << body.code_unit_size() << " " << body.strip_newlines().quoted_str() << std::endl;
+    //----------------//
+
+    // infra UTF-8 decoding //
+    infra_string decoded{u8"na\u00EFve \U0001F600"};
+    std::cout << decoded.code_unit_size() << " " << decoded.code_point_size() << " " << infra_string::utf8_decode(std::string{"\xEF\xBB\xBFok\xFF"}).code_unit_size() << std::endl;
+    //----------------------//
+
+    // infra UTF-8 encoding //
+    const infra_byte_sequence encoded = decoded.byte_encoding();
+    std::cout << encoded.size() << " " << decoded.byte_encoding_size() << " " << (infra_string::utf8_decode(encoded) == decoded) << std::endl;
+    //----------------------//
+
+    // infra isomorphic encoding //
+    const infra_byte_sequence latin1{std::string{"caf\xE9"}};
+    std::cout << infra_string::isomorphic_decode(latin1).code_unit_size() << " " << (infra_string::isomorphic_decode(latin1).isomorphic_encode() == latin1) << std::endl;
+    //---------------------------//
+
+    // infra forgiving-base64 //
+    const infra_string base64 = infra_string::forgiving_base64_encode(infra_byte_sequence{std::string{"infra"}});
+    std::cout << base64.quoted_str() << " " << infra_string{"aW5m\ncmE"}.forgiving_base64_decode()->quoted_string() << " " << infra_string{"aW5mcmE=="}.forgiving_base64_decode().has_value() << std::endl;
+    //------------------------//
+
+    // infra JSON //
+    const auto json = infra_json_value::parse(std::string{"{\"name\": \"infra\", \"tags\": [\"list\", \"map\"], \"version\": 1.5, \"name\": \"whatwg\"}"});
+    std::cout << json->find(infra_string_view{infra_string{"name"}})->as_string().quoted_str() << " " << json->find(infra_string_view{infra_string{"tags"}})->as_list().size() << " " << json->as_map().size() << " " << infra_json_value::parse(std::string{"[1,]"}).has_value() << std::endl;
+    std::string keys{"{"};
+    for (int i = 0; i < 100000; ++i) keys += "\"k" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+    keys += "\"k0\": -1}";
+    const auto repeated = infra_json_value::parse(keys); // one repeated key in a large object is merged without comparing every pair of keys
+    std::cout << repeated->as_map().size() << " " << repeated->as_map().front().second.as_number() << " " << repeated->as_map().back().second.as_number() << std::endl;
+    infra_json_document document;
+    std::cout << document.parse(std::string{"[true, null, 2e3]"}) << " " << document.root().as_list()[2].as_number() << std::endl;
+    std::cout << json->serialize().quoted_string() << " " << document.root().serialize().quoted_string() << std::endl;
+    infra_byte_sequence streamed;
+    {
+        infra_json_serializer serializer{streamed};
+        serializer.begin_map();
+        serializer.key(infra_string{"list"});
+        serializer.write(infra_list<infra_string>{infra_string{"a\tb"}, infra_string{"\""}});
+        serializer.key(infra_string{"count"});
+        serializer.write(infra_uint32{42});
+        serializer.end_map();
+    }
+    std::cout << streamed.quoted_string() << std::endl;
+    infra_json_lazy_document lazy;
+    lazy.parse(std::string{"{\"users\": [{\"name\": \"a\"}, {\"name\": \"b\", \"age\": 30}], \"count\": 2}"});
+    const auto user = lazy.root().find(infra_string_view{infra_string{"users"}})->at(1);
+    std::cout << user->find(infra_string_view{infra_string{"name"}})->as_string()->quoted_str() << " " << *user->find(infra_string_view{infra_string{"age"}})->as_number() << " " << user->materialize()->serialize().quoted_string() << std::endl;
+    //------------//
+
 #ifndef SOFTLOQ_MULTITHREADING
     std::cout << "Testing" << std::endl;
 #endif